@@ -0,0 +1,62 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_BENCH_COMMON_H_
+#define MAYAARRAY_BENCH_COMMON_H_
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <maya/MString.h>
+
+namespace bench {
+
+// element counts every array benchmark is run with
+#define MAYAARRAY_BENCH_SIZES ->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)
+
+// the same pseudo random values on every run, so results can be compared
+inline std::vector<int> randomInts(std::size_t count) {
+	std::mt19937 engine(1234);
+	std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+	std::vector<int> values(count);
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = distribution(engine);
+	return values;
+}
+
+// attribute like names such as "weightList_17", so they share a long prefix
+inline std::vector<MString> names(std::size_t count) {
+	std::vector<MString> values;
+	values.reserve(count);
+	char buffer[32];
+	for (std::size_t i = 0; i < count; ++i) {
+		std::snprintf(buffer, sizeof(buffer), "weightList_%u", static_cast<unsigned>(i));
+		values.push_back(MString(buffer));
+	}
+	return values;
+}
+
+} // namespace bench
+
+#endif // MAYAARRAY_BENCH_COMMON_H_
@@ -0,0 +1,109 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MPointArray.h>
+#include <maya_array/maya_array.h>
+#include "bench_common.h"
+
+using mayaarray::MayaArray;
+
+// filling a Maya array from a std::vector one element at a time
+static void BM_FromVector_ElementLoop(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MIntArray array;
+		array.setLength(static_cast<unsigned int>(values.size()));
+		for (unsigned int i = 0; i < array.length(); ++i)
+			array[i] = values[i];
+		benchmark::DoNotOptimize(array.length());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_FromVector_ElementLoop) MAYAARRAY_BENCH_SIZES;
+
+static void BM_FromVector_RawConstructor(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_FromVector_RawConstructor) MAYAARRAY_BENCH_SIZES;
+
+static void BM_FromVector_Assign(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	MayaArray<MIntArray> array;
+	for (auto _ : state) {
+		array.assign(values.begin(), values.end());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_FromVector_Assign) MAYAARRAY_BENCH_SIZES;
+
+static void BM_ToVector_ElementLoop(benchmark::State& state) {
+	MDoubleArray array(static_cast<unsigned int>(state.range(0)), 1.0);
+	for (auto _ : state) {
+		std::vector<double> values(array.length());
+		for (unsigned int i = 0; i < array.length(); ++i)
+			values[i] = array[i];
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BM_ToVector_ElementLoop) MAYAARRAY_BENCH_SIZES;
+
+static void BM_ToVector_Iterators(benchmark::State& state) {
+	MayaArray<MDoubleArray> array(static_cast<MayaArray<MDoubleArray>::size_type>(state.range(0)), 1.0);
+	for (auto _ : state) {
+		std::vector<double> values(array.begin(), array.end());
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BM_ToVector_Iterators) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Copy_PointArray(benchmark::State& state) {
+	MayaArray<MPointArray> source(static_cast<MayaArray<MPointArray>::size_type>(state.range(0)), MPoint(1.0, 2.0, 3.0));
+	for (auto _ : state) {
+		MayaArray<MPointArray> copy(source);
+		benchmark::DoNotOptimize(copy.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(MPoint));
+}
+BENCHMARK(BM_Copy_PointArray) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Move_PointArray(benchmark::State& state) {
+	MayaArray<MPointArray> source(static_cast<MayaArray<MPointArray>::size_type>(state.range(0)), MPoint(1.0, 2.0, 3.0));
+	for (auto _ : state) {
+		MayaArray<MPointArray> moved(std::move(source));
+		source = std::move(moved);
+		benchmark::DoNotOptimize(source.data());
+	}
+}
+BENCHMARK(BM_Move_PointArray) MAYAARRAY_BENCH_SIZES;
@@ -0,0 +1,103 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MString.h>
+#include <maya/MUniqueString.h>
+#include <maya_templates/maya_stl.h>
+#include "bench_common.h"
+
+using mayatemplates::HashedMString;
+using mayatemplates::MStringEqual;
+using mayatemplates::MStringHash;
+
+static void BM_Hash_MString(benchmark::State& state) {
+	std::vector<MString> keys = bench::names(1024);
+	std::hash<MString> hasher;
+	for (auto _ : state) {
+		for (const MString& key : keys)
+			benchmark::DoNotOptimize(hasher(key));
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Hash_MString);
+
+// the previous std::hash<MString>, which interned the string to hash it
+static void BM_Hash_MStringIntern(benchmark::State& state) {
+	std::vector<MString> keys = bench::names(1024);
+	for (auto _ : state) {
+		for (const MString& key : keys)
+			benchmark::DoNotOptimize(MUniqueString::intern(key).hash());
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Hash_MStringIntern);
+
+static void BM_Lookup_MString(benchmark::State& state) {
+	std::vector<MString> keys = bench::names(static_cast<std::size_t>(state.range(0)));
+	std::unordered_map<MString, int> map;
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		map[keys[i]] = static_cast<int>(i);
+	for (auto _ : state) {
+		for (const MString& key : keys)
+			benchmark::DoNotOptimize(map.find(key));
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Lookup_MString)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_Lookup_HashedMString(benchmark::State& state) {
+	std::vector<MString> names = bench::names(static_cast<std::size_t>(state.range(0)));
+	std::vector<HashedMString> keys(names.begin(), names.end());
+	std::unordered_map<HashedMString, int> map;
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		map[keys[i]] = static_cast<int>(i);
+	for (auto _ : state) {
+		for (const HashedMString& key : keys)
+			benchmark::DoNotOptimize(map.find(key));
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Lookup_HashedMString)->Arg(1 << 8)->Arg(1 << 14);
+
+// looking up with a string literal, which builds a temporary MString unless
+// the library has heterogeneous lookup
+static void BM_Lookup_ConstChar(benchmark::State& state) {
+	std::vector<MString> keys = bench::names(static_cast<std::size_t>(state.range(0)));
+	std::unordered_map<MString, int, MStringHash, MStringEqual> map;
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		map[keys[i]] = static_cast<int>(i);
+	for (auto _ : state) {
+		for (const MString& key : keys) {
+#if defined(__cpp_lib_generic_unordered_lookup)
+			benchmark::DoNotOptimize(map.find(key.asChar()));
+#else
+			benchmark::DoNotOptimize(map.find(MString(key.asChar())));
+#endif
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Lookup_ConstChar)->Arg(1 << 8)->Arg(1 << 14);
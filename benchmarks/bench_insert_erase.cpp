@@ -0,0 +1,90 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MIntArray.h>
+#include <maya_array/maya_array.h>
+#include "bench_common.h"
+
+using mayaarray::MayaArray;
+
+// inserting a block in the middle one element at a time, the way it is done
+// with the Maya array on its own
+static void BM_Insert_MayaLoop(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MIntArray array(values.data(), static_cast<unsigned int>(values.size()));
+		unsigned int middle = array.length() / 2;
+		for (unsigned int i = 0; i < 256; ++i)
+			array.insert(i, middle + i);
+		benchmark::DoNotOptimize(array.length());
+	}
+}
+BENCHMARK(BM_Insert_MayaLoop) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Insert_MayaArrayRange(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	std::vector<int> block(256);
+	for (unsigned int i = 0; i < 256; ++i)
+		block[i] = static_cast<int>(i);
+	for (auto _ : state) {
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		array.insert(array.begin() + array.size() / 2, block.begin(), block.end());
+		benchmark::DoNotOptimize(array.size());
+	}
+}
+BENCHMARK(BM_Insert_MayaArrayRange) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Erase_MayaLoop(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MIntArray array(values.data(), static_cast<unsigned int>(values.size()));
+		unsigned int middle = array.length() / 2;
+		for (unsigned int i = 0; i < 256; ++i)
+			array.remove(middle);
+		benchmark::DoNotOptimize(array.length());
+	}
+}
+BENCHMARK(BM_Erase_MayaLoop) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Erase_MayaArrayRange(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		auto middle = array.begin() + array.size() / 2;
+		array.erase(middle, middle + 256);
+		benchmark::DoNotOptimize(array.size());
+	}
+}
+BENCHMARK(BM_Erase_MayaArrayRange) MAYAARRAY_BENCH_SIZES;
+
+static void BM_EraseIf_MayaArray(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		benchmark::DoNotOptimize(mayaarray::erase_if(array, [](int value) { return value < 0; }));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EraseIf_MayaArray) MAYAARRAY_BENCH_SIZES;
@@ -0,0 +1,99 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MIntArray.h>
+#include <maya/MPointArray.h>
+#include <maya_array/maya_array.h>
+#include <maya_iteration/maya_array_range.h>
+#include "bench_common.h"
+
+using mayaarray::MayaArray;
+using mayaiteration::MayaArrayRange;
+using mayaiteration::checked_iterators;
+using mayaiteration::unchecked_iterators;
+
+// the loop Maya code is usually written with, one call per element
+static void BM_Iterate_IndexLoop(benchmark::State& state) {
+	MIntArray array(static_cast<unsigned int>(state.range(0)), 1);
+	for (auto _ : state) {
+		long long sum = 0;
+		for (unsigned int i = 0, n = array.length(); i < n; ++i)
+			sum += array[i];
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_IndexLoop) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Iterate_RangeUnchecked(benchmark::State& state) {
+	MIntArray array(static_cast<unsigned int>(state.range(0)), 1);
+	for (auto _ : state) {
+		MayaArrayRange<MIntArray, unchecked_iterators> range(array);
+		benchmark::DoNotOptimize(std::accumulate(range.begin(), range.end(), 0LL));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_RangeUnchecked) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Iterate_RangeChecked(benchmark::State& state) {
+	MIntArray array(static_cast<unsigned int>(state.range(0)), 1);
+	for (auto _ : state) {
+		MayaArrayRange<MIntArray, checked_iterators> range(array);
+		benchmark::DoNotOptimize(std::accumulate(range.begin(), range.end(), 0LL));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_RangeChecked) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Iterate_MayaArray(benchmark::State& state) {
+	MayaArray<MIntArray> array(static_cast<MayaArray<MIntArray>::size_type>(state.range(0)), 1);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(std::accumulate(array.begin(), array.end(), 0LL));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_MayaArray) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Iterate_StdVector(benchmark::State& state) {
+	std::vector<int> values(static_cast<std::size_t>(state.range(0)), 1);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(std::accumulate(values.begin(), values.end(), 0LL));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_StdVector) MAYAARRAY_BENCH_SIZES;
+
+// a larger element type, summing one component of every point
+static void BM_Iterate_PointRange(benchmark::State& state) {
+	MPointArray points(static_cast<unsigned int>(state.range(0)), MPoint(1.0, 2.0, 3.0));
+	for (auto _ : state) {
+		MayaArrayRange<MPointArray> range(points);
+		double sum = 0.0;
+		for (const MPoint& point : range)
+			sum += point.y;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Iterate_PointRange) MAYAARRAY_BENCH_SIZES;
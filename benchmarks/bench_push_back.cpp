@@ -0,0 +1,118 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MIntArray.h>
+#include <maya/MPointArray.h>
+#include <maya_array/maya_array.h>
+#include "bench_common.h"
+
+using mayaarray::MayaArray;
+
+// "growths" reports how many times the capacity was increased while filling,
+// so the growth factor can be compared with Maya's fixed size increment
+
+static void BM_PushBack_MayaAppend(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	for (auto _ : state) {
+		MIntArray array;
+		for (unsigned int i = 0; i < count; ++i)
+			array.append(static_cast<int>(i));
+		benchmark::DoNotOptimize(array.length());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// growing by the size increment is quadratic, so the largest size is left out
+BENCHMARK(BM_PushBack_MayaAppend)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_PushBack_GrowthFactor(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	double growths = 0.0;
+	for (auto _ : state) {
+		MayaArray<MIntArray> array;
+		for (unsigned int i = 0; i < count; ++i)
+			array.push_back(static_cast<int>(i));
+		growths = static_cast<double>(array.growth_count());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.counters["growths"] = growths;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushBack_GrowthFactor) MAYAARRAY_BENCH_SIZES;
+
+static void BM_PushBack_NoGrowthFactor(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	double growths = 0.0;
+	for (auto _ : state) {
+		MayaArray<MIntArray> array;
+		array.set_growth_factor(1.0f);
+		for (unsigned int i = 0; i < count; ++i)
+			array.push_back(static_cast<int>(i));
+		growths = static_cast<double>(array.growth_count());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.counters["growths"] = growths;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushBack_NoGrowthFactor)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_PushBack_Reserve(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	double growths = 0.0;
+	for (auto _ : state) {
+		MayaArray<MIntArray> array;
+		array.reserve(count);
+		for (unsigned int i = 0; i < count; ++i)
+			array.push_back(static_cast<int>(i));
+		growths = static_cast<double>(array.growth_count());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.counters["growths"] = growths;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushBack_Reserve) MAYAARRAY_BENCH_SIZES;
+
+static void BM_PushBack_Points(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	for (auto _ : state) {
+		MayaArray<MPointArray> array;
+		for (unsigned int i = 0; i < count; ++i)
+			array.push_back(MPoint(i, i, i));
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushBack_Points) MAYAARRAY_BENCH_SIZES;
+
+static void BM_PushBack_StdVector(benchmark::State& state) {
+	unsigned int count = static_cast<unsigned int>(state.range(0));
+	for (auto _ : state) {
+		std::vector<int> values;
+		for (unsigned int i = 0; i < count; ++i)
+			values.push_back(static_cast<int>(i));
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushBack_StdVector) MAYAARRAY_BENCH_SIZES;
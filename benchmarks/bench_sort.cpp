@@ -0,0 +1,89 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <maya/MIntArray.h>
+#include <maya/MStringArray.h>
+#include <maya_array/maya_array.h>
+#include <maya_array/maya_array_sort.h>
+#include "bench_common.h"
+
+using mayaarray::MayaArray;
+
+static void BM_Sort_MayaArrayStdSort(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		state.PauseTiming();
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		state.ResumeTiming();
+		std::sort(array.begin(), array.end());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sort_MayaArrayStdSort) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Sort_MayaArrayRadixSort(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		state.PauseTiming();
+		MayaArray<MIntArray> array(values.data(), static_cast<MayaArray<MIntArray>::size_type>(values.size()));
+		state.ResumeTiming();
+		mayaarray::radix_sort(array);
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sort_MayaArrayRadixSort) MAYAARRAY_BENCH_SIZES;
+
+static void BM_Sort_StdVector(benchmark::State& state) {
+	std::vector<int> values = bench::randomInts(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		state.PauseTiming();
+		std::vector<int> copy(values);
+		state.ResumeTiming();
+		std::sort(copy.begin(), copy.end());
+		benchmark::DoNotOptimize(copy.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sort_StdVector) MAYAARRAY_BENCH_SIZES;
+
+// strings are not contiguous in Maya, so every swap goes through operator[]
+static void BM_Sort_MayaStringArray(benchmark::State& state) {
+	std::vector<MString> values = bench::names(static_cast<std::size_t>(state.range(0)));
+	std::reverse(values.begin(), values.end());
+	auto less = [](const MString& a, const MString& b) { return std::strcmp(a.asChar(), b.asChar()) < 0; };
+	for (auto _ : state) {
+		state.PauseTiming();
+		MayaArray<MStringArray> array(values.data(), static_cast<MayaArray<MStringArray>::size_type>(values.size()));
+		state.ResumeTiming();
+		std::sort(array.begin(), array.end(), less);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sort_MayaStringArray)->Arg(1 << 10)->Arg(1 << 14);
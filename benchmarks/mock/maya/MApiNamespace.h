@@ -0,0 +1,57 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MAPINAMESPACE_H_
+#define MOCKMAYA_MAPINAMESPACE_H_
+
+/*
+Forward declarations of the Maya API classes the headers refer to, standing in
+for the devkit header of the same name.
+*/
+class MStatus;
+class MString;
+class MStringArray;
+class MIntArray;
+class MUintArray;
+class MInt64Array;
+class MFloatArray;
+class MDoubleArray;
+class MPoint;
+class MPointArray;
+class MFloatPointArray;
+class MVector;
+class MVectorArray;
+class MFloatVectorArray;
+class MColorArray;
+class MDagPathArray;
+class MObjectArray;
+class MPlugArray;
+class MMatrixArray;
+class MObject;
+class MObjectHandle;
+class MDagPath;
+class MPlug;
+class MUniqueString;
+class MUuid;
+
+#endif // MOCKMAYA_MAPINAMESPACE_H_
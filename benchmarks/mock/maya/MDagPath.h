@@ -0,0 +1,45 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MDAGPATH_H_
+#define MOCKMAYA_MDAGPATH_H_
+
+#include <maya/MObject.h>
+#include <maya/MStatus.h>
+
+class MDagPath {
+public:
+	MDagPath() : mInstance(0) {}
+	MDagPath(const MObject& node, unsigned int instance) : mNode(node), mInstance(instance) {}
+
+	MObject node(MStatus* = nullptr) const { return mNode; }
+	unsigned int instanceNumber(MStatus* = nullptr) const { return mInstance; }
+
+	bool operator==(const MDagPath& other) const { return mNode == other.mNode && mInstance == other.mInstance; }
+
+private:
+	MObject mNode;
+	unsigned int mInstance;
+};
+
+#endif // MOCKMAYA_MDAGPATH_H_
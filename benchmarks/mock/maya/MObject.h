@@ -0,0 +1,46 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MOBJECT_H_
+#define MOCKMAYA_MOBJECT_H_
+
+#include <cstdint>
+#include <maya/MApiNamespace.h>
+
+// the mock objects are identified by a number instead of a Maya node
+class MObject {
+public:
+	MObject() : mId(0) {}
+	explicit MObject(std::uintptr_t id) : mId(id) {}
+
+	bool isNull() const { return mId == 0; }
+	std::uintptr_t id() const { return mId; }
+
+	bool operator==(const MObject& other) const { return mId == other.mId; }
+	bool operator!=(const MObject& other) const { return mId != other.mId; }
+
+private:
+	std::uintptr_t mId;
+};
+
+#endif // MOCKMAYA_MOBJECT_H_
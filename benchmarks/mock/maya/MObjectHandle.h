@@ -0,0 +1,44 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MOBJECTHANDLE_H_
+#define MOCKMAYA_MOBJECTHANDLE_H_
+
+#include <maya/MObject.h>
+
+class MObjectHandle {
+public:
+	MObjectHandle() {}
+	MObjectHandle(const MObject& object) : mObject(object) {}
+
+	MObject object() const { return mObject; }
+	unsigned int hashCode() const { return static_cast<unsigned int>(mObject.id() * 2654435761u); }
+
+	bool operator==(const MObjectHandle& other) const { return mObject == other.mObject; }
+	bool operator!=(const MObjectHandle& other) const { return mObject != other.mObject; }
+
+private:
+	MObject mObject;
+};
+
+#endif // MOCKMAYA_MOBJECTHANDLE_H_
@@ -0,0 +1,66 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MPLUG_H_
+#define MOCKMAYA_MPLUG_H_
+
+#include <memory>
+#include <maya/MObject.h>
+#include <maya/MStatus.h>
+
+// only plugs on one node and attribute are modeled, with a chain of parent
+// array elements for nested plugs
+class MPlug {
+public:
+	MPlug() : mIndex(0), mElement(false) {}
+	MPlug(const MObject& node, const MObject& attribute) : mNode(node), mAttribute(attribute), mIndex(0), mElement(false) {}
+
+	MPlug elementByLogicalIndex(unsigned int index, MStatus* = nullptr) const {
+		MPlug element(*this);
+		element.mIndex = index;
+		element.mElement = true;
+		element.mArray = std::make_shared<MPlug>(*this);
+		return element;
+	}
+
+	MObject node(MStatus* = nullptr) const { return mNode; }
+	MObject attribute(MStatus* = nullptr) const { return mAttribute; }
+	bool isElement(MStatus* = nullptr) const { return mElement; }
+	bool isChild(MStatus* = nullptr) const { return false; }
+	unsigned int logicalIndex(MStatus* = nullptr) const { return mIndex; }
+	MPlug array(MStatus* = nullptr) const { return mArray ? *mArray : MPlug(); }
+	MPlug parent(MStatus* = nullptr) const { return MPlug(); }
+
+	bool operator==(const MPlug& other) const {
+		return mNode == other.mNode && mAttribute == other.mAttribute && mIndex == other.mIndex && mElement == other.mElement;
+	}
+
+private:
+	MObject mNode;
+	MObject mAttribute;
+	unsigned int mIndex;
+	bool mElement;
+	std::shared_ptr<MPlug> mArray;
+};
+
+#endif // MOCKMAYA_MPLUG_H_
@@ -0,0 +1,58 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MSTATUS_H_
+#define MOCKMAYA_MSTATUS_H_
+
+#include <maya/MApiNamespace.h>
+
+/*
+Status returned by the mock Maya classes. The mock never fails, so only
+success and failure are modeled.
+*/
+class MStatus {
+public:
+	enum MStatusCode {
+		kSuccess = 0,
+		kFailure = 1
+	};
+
+	MStatus() : mCode(kSuccess) {}
+	MStatus(MStatusCode code) : mCode(code) {}
+
+	MStatusCode statusCode() const { return mCode; }
+	operator bool() const { return mCode == kSuccess; }
+	bool operator!() const { return mCode != kSuccess; }
+	bool operator==(const MStatus& other) const { return mCode == other.mCode; }
+	bool operator!=(const MStatus& other) const { return mCode != other.mCode; }
+
+private:
+	MStatusCode mCode;
+};
+
+namespace MS {
+	const MStatus::MStatusCode kSuccess = MStatus::kSuccess;
+	const MStatus::MStatusCode kFailure = MStatus::kFailure;
+}
+
+#endif // MOCKMAYA_MSTATUS_H_
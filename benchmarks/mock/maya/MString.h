@@ -0,0 +1,61 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MSTRING_H_
+#define MOCKMAYA_MSTRING_H_
+
+#include <string>
+#include <maya/MStatus.h>
+
+/*
+Stand in for MString. Like Maya's it holds its characters in a separate heap
+allocation, which matters for the copy and hash benchmarks.
+*/
+class MString {
+public:
+	MString() {}
+	MString(const char* chars) : mChars(chars) {}
+	MString(const char* chars, int length) : mChars(chars, length) {}
+
+	const char* asChar() const { return mChars.c_str(); }
+	unsigned int length() const { return static_cast<unsigned int>(mChars.size()); }
+	unsigned int numChars() const { return length(); }
+
+	MStatus set(const char* chars) {
+		mChars = chars;
+		return MS::kSuccess;
+	}
+
+	MString& operator+=(const MString& other) {
+		mChars += other.mChars;
+		return *this;
+	}
+
+	bool operator==(const MString& other) const { return mChars == other.mChars; }
+	bool operator!=(const MString& other) const { return mChars != other.mChars; }
+
+private:
+	std::string mChars;
+};
+
+#endif // MOCKMAYA_MSTRING_H_
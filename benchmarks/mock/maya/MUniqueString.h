@@ -0,0 +1,68 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MUNIQUESTRING_H_
+#define MOCKMAYA_MUNIQUESTRING_H_
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <maya/MApiNamespace.h>
+#include <maya/MString.h>
+
+/*
+Stand in for MUniqueString. Like Maya's, interning looks the characters up in
+a global table under a lock, so the interned strings can be compared by
+pointer.
+*/
+class MUniqueString {
+public:
+	MUniqueString() : mChars(&empty()) {}
+
+	static MUniqueString intern(const char* chars) {
+		static std::mutex lock;
+		static std::unordered_set<std::string> table;
+		std::lock_guard<std::mutex> guard(lock);
+		return MUniqueString(&*table.insert(chars).first);
+	}
+
+	static MUniqueString intern(const MString& value) { return intern(value.asChar()); }
+
+	const char* asChar() const { return mChars->c_str(); }
+	std::size_t hash() const { return std::hash<std::string>()(*mChars); }
+
+	bool operator==(const MUniqueString& other) const { return mChars == other.mChars; }
+
+private:
+	explicit MUniqueString(const std::string* chars) : mChars(chars) {}
+
+	static const std::string& empty() {
+		static const std::string chars;
+		return chars;
+	}
+
+	const std::string* mChars;
+};
+
+#endif // MOCKMAYA_MUNIQUESTRING_H_
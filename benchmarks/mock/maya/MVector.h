@@ -0,0 +1,45 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MVECTOR_H_
+#define MOCKMAYA_MVECTOR_H_
+
+#include <maya/MApiNamespace.h>
+
+class MVector {
+public:
+	MVector() : x(0.0), y(0.0), z(0.0) {}
+	MVector(double xx, double yy, double zz = 0.0) : x(xx), y(yy), z(zz) {}
+	MVector(const MVector& other) : x(other.x), y(other.y), z(other.z) {}
+	MVector& operator=(const MVector& other) {
+		x = other.x; y = other.y; z = other.z;
+		return *this;
+	}
+
+	bool operator==(const MVector& other) const { return x == other.x && y == other.y && z == other.z; }
+	bool operator!=(const MVector& other) const { return !(*this == other); }
+
+	double x, y, z;
+};
+
+#endif // MOCKMAYA_MVECTOR_H_
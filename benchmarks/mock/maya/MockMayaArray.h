@@ -0,0 +1,177 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MOCKMAYA_MOCKMAYAARRAY_H_
+#define MOCKMAYA_MOCKMAYAARRAY_H_
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <maya/MStatus.h>
+
+// Maya's array methods are calls into OpenMaya, so the mock keeps them out of
+// line to give the benchmarks the same call overhead per element access
+#if defined(_MSC_VER)
+#define MOCKMAYA_NOINLINE __declspec(noinline)
+#else
+#define MOCKMAYA_NOINLINE __attribute__((noinline))
+#endif
+
+/*
+DESCRIPTION:
+Stand in for the Maya M***Array classes, used to build the benchmarks without
+the Maya devkit. It follows the documented behavior of the Maya arrays: growing
+past the allocated length reallocates by the size increment, clearing keeps the
+memory, and insert and remove shift the elements after the index. Maya does not
+document whether shortening an array with setLength keeps the memory, so the
+mock takes the costlier reading and reallocates to the new length.
+
+USAGE:
+The array classes derive from it, e.g.
+class MIntArray : public MockMayaArray<int> { ... };
+*/
+template<typename V>
+class MockMayaArray {
+public:
+	MockMayaArray() : mData(nullptr), mLength(0), mCapacity(0), mSizeIncrement(8) {}
+
+	MockMayaArray(unsigned int count, const V& value = V()) : MockMayaArray() {
+		setLength(count);
+		std::fill(mData, mData + count, value);
+	}
+
+	MockMayaArray(const V* values, unsigned int count) : MockMayaArray() {
+		setLength(count);
+		std::copy(values, values + count, mData);
+	}
+
+	MockMayaArray(const MockMayaArray& other) : MockMayaArray(other.mData, other.mLength) {}
+
+	~MockMayaArray() {
+		destroy();
+	}
+
+	MockMayaArray& operator=(const MockMayaArray& other) {
+		copy(other);
+		return *this;
+	}
+
+	MOCKMAYA_NOINLINE const V& operator[](unsigned int index) const { return mData[index]; }
+	MOCKMAYA_NOINLINE V& operator[](unsigned int index) { return mData[index]; }
+
+	MOCKMAYA_NOINLINE unsigned int length() const { return mLength; }
+
+	MOCKMAYA_NOINLINE MStatus setLength(unsigned int length) {
+		if (mCapacity < length)
+			reallocate(std::max(length, mCapacity + mSizeIncrement));
+		else if (length < mLength)
+			reallocate(length);
+		std::fill(mData + mLength, mData + std::max(mLength, length), V());
+		mLength = length;
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus append(const V& value) {
+		if (mCapacity <= mLength)
+			reallocate(mCapacity + mSizeIncrement);
+		mData[mLength++] = value;
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus insert(const V& value, unsigned int index) {
+		if (mLength < index)
+			return MS::kFailure;
+		V copy(value);
+		if (mCapacity <= mLength)
+			reallocate(mCapacity + mSizeIncrement);
+		std::copy_backward(mData + index, mData + mLength, mData + mLength + 1);
+		mData[index] = copy;
+		++mLength;
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus remove(unsigned int index) {
+		if (mLength <= index)
+			return MS::kFailure;
+		std::copy(mData + index + 1, mData + mLength, mData + index);
+		mData[--mLength] = V();
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus set(const V& value, unsigned int index) {
+		if (mLength <= index)
+			return MS::kFailure;
+		mData[index] = value;
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus clear() {
+		mLength = 0;
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE MStatus copy(const MockMayaArray& source) {
+		if (this != &source) {
+			clear();
+			setLength(source.mLength);
+			std::copy(source.mData, source.mData + source.mLength, mData);
+		}
+		return MS::kSuccess;
+	}
+
+	MOCKMAYA_NOINLINE void setSizeIncrement(unsigned int increment) { mSizeIncrement = increment < 1 ? 1 : increment; }
+	MOCKMAYA_NOINLINE unsigned int sizeIncrement() const { return mSizeIncrement; }
+
+protected:
+	MOCKMAYA_NOINLINE MStatus getValues(V* values) const {
+		std::copy(mData, mData + mLength, values);
+		return MS::kSuccess;
+	}
+
+private:
+	void reallocate(unsigned int capacity) {
+		V* data = static_cast<V*>(std::malloc(sizeof(V) * (capacity ? capacity : 1)));
+		if (!data)
+			throw std::bad_alloc();
+		for (unsigned int i = 0; i < capacity; ++i)
+			new (data + i) V(i < mLength ? mData[i] : V());
+		destroy();
+		mData = data;
+		mCapacity = capacity;
+	}
+
+	void destroy() {
+		for (unsigned int i = 0; i < mCapacity; ++i)
+			mData[i].~V();
+		std::free(mData);
+		mData = nullptr;
+		mCapacity = 0;
+	}
+
+	V* mData;
+	unsigned int mLength;
+	unsigned int mCapacity;
+	unsigned int mSizeIncrement;
+};
+
+#endif // MOCKMAYA_MOCKMAYAARRAY_H_
@@ -24,8 +24,16 @@ THE SOFTWARE.
 #ifndef MAYAARRAY_MAYA_ARRAY_H_
 #define MAYAARRAY_MAYA_ARRAY_H_
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <maya_array/maya_array_stats.h>
 #include <maya_iteration/maya_array_range.h>
+#include <maya_templates/maya_array_traits.h>
 
 namespace mayaarray {
 
@@ -46,6 +54,31 @@ A MayaArray instance provides the commonly used "begin()" and "end()"
 functions. This returns a random access compliant iterator. See the
 standard library iterator documentation for more information on using
 the iterator instance. More functionality will be added for more support.
+For Maya arrays with contiguous storage, the iterators are plain pointers and
+"data()" returns a pointer to the first element. These are invalidated when the
+array reallocates, the same as std::vector iterators.
+
+The second template parameter is the iterator policy. With
+mayaiteration::checked_iterators iterators are checked for being in range and
+for being used after a change to the array such as "insert", "erase" or
+"resize" invalidated them. Changes made directly to the Maya array through
+"array()" are not tracked. The generation the iterators are checked against
+is kept on the heap next to the Maya array, so iterators stay valid and
+checked when the MayaArray is moved or swapped, and like std::vector iterators
+they must not be used after the array is destroyed. With
+mayaiteration::unchecked_iterators, the default, nothing is checked and the
+iterators of contiguous arrays are plain pointers.
+
+Copying, filling and moving elements of arrays whose elements are plain data,
+as reported by mayatemplates::maya_array_traits, is done with memcpy, memmove
+and memset instead of element by element.
+
+The Maya array is kept on the heap, so moving and swapping MayaArray instances
+only hand over a pointer and never copy the elements. Maya's own array classes
+cannot be moved, so taking the contents of a M***Array by "adopt(T&&)" or
+giving them back by "release()" copies the elements unless the Maya array type
+has move support. The overloads taking and returning a std::unique_ptr to the
+Maya array never copy.
 
 USAGE:
 	// Create an empty MPointArray that is wrapped around this generic interface
@@ -86,30 +119,61 @@ USAGE:
 	// append 3 default MPoints to the array using standard library algorithm fill_n
 	std::fill_n(std::back_inserter(meshPoints), 3, MPoint());
 
-	// erase points from beginIt to endIt
-	meshPoints.erase(beginIt, endIt);
+	// erase the first two points, appending may have invalidated beginIt and endIt
+	meshPoints.erase(meshPoints.begin(), meshPoints.begin() + 2);
+
+	// pass the contiguous point data to code that expects a raw pointer
+	const MPoint* rawPoints = meshPoints.data();
+
+	// erase all negative ids from a MIntArray in one pass
+	mayaarray::MayaArray<MIntArray> ids;
+	mayaarray::erase_if(ids, [](int id) { return id < 0; });
 */
-template<typename T>
+template<typename T, typename Policy=mayaiteration::default_iterator_policy>
 class MayaArray {
 protected:
-	T mArray;
+	// the Maya array is kept on the heap so that moving and swapping only hand
+	// over the pointer, Maya's array classes cannot be moved. It is null until
+	// the array is first changed and after it was moved from, which reads as
+	// an empty array.
+	std::unique_ptr<T> mArray;
 
 public:
 	// there are different types returned based if the array is const or not
-	typedef typename decltype(std::declval<T>()[0]) reference;
-	typedef typename decltype(std::declval<const T>()[0]) const_reference;
+	typedef decltype(std::declval<T&>()[0]) reference;
+	typedef decltype(std::declval<const T&>()[0]) const_reference;
 	typedef typename std::remove_reference<reference>::type value_type;
 	typedef unsigned int size_type;
 
-	typedef typename mayaiteration::MayaArrayRange<T>::iterator iterator;
-	typedef typename mayaiteration::MayaArrayRange<T>::const_iterator const_iterator;
-	typedef typename mayaiteration::MayaArrayRange<T>::reverse_iterator reverse_iterator;
-	typedef typename mayaiteration::MayaArrayRange<T>::const_reverse_iterator const_reverse_iterator;
+	typedef Policy iterator_policy;
+	typedef typename mayaiteration::MayaArrayRange<T, Policy>::iterator iterator;
+	typedef typename mayaiteration::MayaArrayRange<T, Policy>::const_iterator const_iterator;
+	typedef typename mayaiteration::MayaArrayRange<T, Policy>::reverse_iterator reverse_iterator;
+	typedef typename mayaiteration::MayaArrayRange<T, Policy>::const_reverse_iterator const_reverse_iterator;
+
+protected:
+	typedef mayaiteration::MayaArrayRange<T, Policy> range_type;
+	typedef mayatemplates::maya_array_traits<T> traits_type;
+	typedef typename traits_type::is_raw_copyable is_raw_copyable;
+
+	typedef typename std::conditional<range_type::is_checked::value,
+		mayaiteration::detail::GenerationCounter, mayaiteration::detail::NoGenerationCounter>::type generation_type;
+
+	size_type mCapacity;
+	size_type mGrowthCount;
+	float mGrowthFactor;
+	// changes when iterators are invalidated, only kept for checked iterators
+	generation_type mGeneration;
+
+public:
 
 	/**
-    Creates an empty array
+    Creates an empty array, the Maya array is not created until the array is
+	changed
 	*/
-	MayaArray() {}
+	MayaArray() : mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+	}
 
 	/**
     Creates an array of "count" elements with the given value.
@@ -117,14 +181,36 @@ public:
 	\param[in] count number of elements in the array
 	\param[in] value the initial value of the elements
 	*/
-	MayaArray(size_type count, const value_type& value=value_type()) : mArray(count, value) {}
+	MayaArray(size_type count, const value_type& value=value_type())
+		: mArray(new T(count, value)), mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+	}
 
 	/**
     Creates an array with a copy of the given M***Array instance
 
 	\param[in] maya_array the Maya array to copy
 	*/
-	MayaArray(const T& maya_array) : mArray(maya_array) {}
+	MayaArray(const T& maya_array) : mArray(new T(maya_array)), mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+	}
+
+	/**
+    Creates an array with a copy of "count" values starting at the pointer,
+	using the Maya array's own raw constructor when it has one.
+
+	\param[in] values pointer to the first value
+	\param[in] count number of values
+	*/
+	MayaArray(const value_type* values, size_type count)
+		: mArray(fromRaw(values, count, typename traits_type::has_raw_constructor())),
+		mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, count * sizeof(value_type));
+	}
 
 	/**
     Creates a copy of another MayaArray instance, copying elements
@@ -132,7 +218,51 @@ public:
 
 	\param[in] other the other MayaArray instance to copy
 	*/
-	MayaArray(const MayaArray& other) : mArray(other.mArray) {}
+	MayaArray(const MayaArray& other)
+		: mArray(other.mArray ? new T(*other.mArray) : nullptr), mCapacity(0), mGrowthCount(0), mGrowthFactor(other.mGrowthFactor) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+	}
+
+	/**
+    Creates an array with the contents of the given M***Array instance. Maya's
+	array classes cannot be moved, so unless the Maya array type has move
+	support this copies the elements. Use the constructor taking a
+	std::unique_ptr to take over a Maya array without copying.
+
+	\param[in] maya_array the Maya array to take the contents of
+	*/
+	MayaArray(T&& maya_array) : mArray(new T(std::move(maya_array))), mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+	}
+
+	/**
+    Creates an array that takes ownership of the given heap allocated M***Array
+	instance without copying it. A null pointer creates an empty array.
+
+	\param[in] maya_array the Maya array to take ownership of
+	*/
+	explicit MayaArray(std::unique_ptr<T> maya_array)
+		: mArray(std::move(maya_array)), mCapacity(0), mGrowthCount(0), mGrowthFactor(2.0f) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+	}
+
+	/**
+    Creates an array that takes over the Maya array of another MayaArray
+	instance without copying the elements, leaving the other array empty.
+
+	\param[in] other the other MayaArray instance to take the contents of
+	*/
+	MayaArray(MayaArray&& other) noexcept
+		: mArray(std::move(other.mArray)), mCapacity(other.mCapacity),
+		mGrowthCount(other.mGrowthCount), mGrowthFactor(other.mGrowthFactor), mGeneration(std::move(other.mGeneration)) {
+		MAYAARRAY_COUNT(T, kCountConstructions, 1);
+		other.mCapacity = 0;
+		other.mGrowthCount = 0;
+	}
 
 	/**
     Assigns all values from a M***Array instance to this array
@@ -140,7 +270,11 @@ public:
 	\param[in] other the Maya array to assign values from
 	*/
 	MayaArray& operator=(const T& other) {
-		mArray = other;
+		storage() = other;
+		mCapacity = 0;
+		invalidate();
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
 		return *this;
 	}
 
@@ -150,43 +284,183 @@ public:
 	\param[in] other the Maya array to assign values from
 	*/
 	MayaArray& operator=(const MayaArray& other) {
-		mArray = other.mArray;
+		if (this != &other) {
+			storage() = other.elements();
+			mCapacity = 0;
+			invalidate();
+			MAYAARRAY_COUNT(T, kCountCopies, 1);
+			MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+		}
 		return *this;
 	}
 
 	/**
-    Returns a reference to underlying Maya array instance
+    Replaces the contents with those of a M***Array instance, the same as "adopt"
+
+	\param[in] other the Maya array to take the contents of
+	*/
+	MayaArray& operator=(T&& other) {
+		adopt(std::move(other));
+		return *this;
+	}
+
+	/**
+    Takes over the Maya array of another MayaArray instance without copying the
+	elements, leaving the other array empty. Iterators of the other array stay
+	valid and now belong to this array.
+
+	\param[in] other the other MayaArray instance to take the contents of
+	*/
+	MayaArray& operator=(MayaArray&& other) noexcept {
+		if (this != &other) {
+			mArray = std::move(other.mArray);
+			mCapacity = other.mCapacity;
+			mGrowthCount = other.mGrowthCount;
+			mGrowthFactor = other.mGrowthFactor;
+			other.mCapacity = 0;
+			other.mGrowthCount = 0;
+			// the other array keeps the generation of the elements this array
+			// had, so their iterators are caught as long as it exists. A moved
+			// from array has none, which is not created here so this cannot throw.
+			mGeneration.swap(other.mGeneration);
+			if (other.mGeneration.get())
+				other.invalidate();
+		}
+		return *this;
+	}
+
+	/**
+    Replaces the contents of this array with the given M***Array instance. Maya's
+	array classes cannot be moved, so unless the Maya array type has move
+	support this is the same as assigning the array, which copies the elements
+	but reuses the memory this array already has. Use the overload taking a
+	std::unique_ptr to take over a Maya array without copying.
+
+	\param[in] maya_array the Maya array to take the contents of
+	*/
+	void adopt(T&& maya_array) {
+		storage() = std::move(maya_array);
+		mCapacity = 0;
+		invalidate();
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+	}
+
+	/**
+    Replaces the contents of this array by taking ownership of the given heap
+	allocated M***Array instance, without copying it. A null pointer leaves
+	this array empty.
+
+	\param[in] maya_array the Maya array to take ownership of
+	*/
+	void adopt(std::unique_ptr<T> maya_array) {
+		mArray = std::move(maya_array);
+		mCapacity = 0;
+		invalidate();
+	}
+
+	/**
+    Returns the contents of this array as a M***Array instance and leaves this
+	array empty. Maya's array classes cannot be moved, so unless the Maya array
+	type has move support the elements are copied into the returned array. Use
+	"release_storage" to hand the Maya array over without copying.
+
+	\return
+	the Maya array with the contents of this array
+	*/
+	T release() {
+		MAYAARRAY_COUNT(T, kCountCopies, 1);
+		MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+		std::unique_ptr<T> released(release_storage());
+		return T(std::move(*released));
+	}
+
+	/**
+    Hands the heap allocated Maya array over to the caller without copying it
+	and leaves this array empty.
+
+	\return
+	the Maya array with the contents of this array, never null
+	*/
+	std::unique_ptr<T> release_storage() {
+		std::unique_ptr<T> released(std::move(mArray));
+		if (!released)
+			released.reset(new T());
+		mCapacity = 0;
+		invalidate();
+		return released;
+	}
+
+	/**
+    Exchanges the contents of this array with another MayaArray instance. Only
+	the pointers to the Maya arrays are exchanged, no elements are copied, and
+	iterators stay valid and belong to the other array, as with std::vector.
+
+	\param[in] other the other MayaArray instance to swap with
+	*/
+	void swap(MayaArray& other) noexcept {
+		using std::swap;
+		swap(mArray, other.mArray);
+		swap(mCapacity, other.mCapacity);
+		swap(mGrowthCount, other.mGrowthCount);
+		swap(mGrowthFactor, other.mGrowthFactor);
+		mGeneration.swap(other.mGeneration);
+	}
+
+	/**
+    Returns a reference to underlying Maya array instance. The capacity is kept,
+	and since "capacity()" is never less than the size, growing the array
+	through it is seen. Assigning another array to it may give up the extra
+	room without this class knowing, use "shrink_to_fit" after doing so.
 	*/
 	inline T& array() {
-		return mArray;
+		return storage();
 	}
 
 	/**
 	Returns a const reference to the underlying Maya array instance
 	*/
 	inline const T& array() const {
-		return mArray;
+		return elements();
+	}
+
+	/**
+    Returns a pointer to the first element in the array or null if the array
+	is empty. This is only available for Maya arrays with contiguous storage.
+	*/
+	inline value_type* data() {
+		static_assert(range_type::is_contiguous::value, "Maya array type does not have contiguous storage");
+		return range_type::dataOf(elements());
+	}
+
+	/**
+    Returns a const pointer to the first element in the array or null if the
+	array is empty. This is only available for Maya arrays with contiguous storage.
+	*/
+	inline const value_type* data() const {
+		static_assert(range_type::is_contiguous::value, "Maya array type does not have contiguous storage");
+		return range_type::dataOf(elements());
 	}
 
 	/**
     Returns an iterator for the first element in the array
 	*/
 	inline iterator begin() {
-		return iterator(mArray);
+		return range_type::iteratorAt(elements(), 0, mGeneration.get());
 	}
 
 	/**
     Returns a const iterator for the first element in the array
 	*/
 	inline const_iterator begin() const {
-		return const_iterator(mArray);
+		return range_type::iteratorAt(elements(), 0, mGeneration.get());
 	}
 
 	/**
     Returns a const iterator for the first element in the array
 	*/
 	inline const_iterator cbegin() const {
-		return const_iterator(mArray);
+		return range_type::iteratorAt(elements(), 0, mGeneration.get());
 	}
 
 	/**
@@ -214,21 +488,21 @@ public:
     Returns an iterator for one past the last element in the array
 	*/
 	inline iterator end() {
-		return iterator(mArray, mArray.length());
+		return range_type::iteratorAt(elements(), elements().length(), mGeneration.get());
 	}
 
 	/**
     Returns a const iterator for one past the last element in the array
 	*/
 	inline const_iterator end() const {
-		return const_iterator(mArray, mArray.length());
+		return range_type::iteratorAt(elements(), elements().length(), mGeneration.get());
 	}
 
 	/**
     Returns a const iterator for one past the last element in the array
 	*/
 	inline const_iterator cend() const {
-		return const_iterator(mArray, mArray.length());
+		return range_type::iteratorAt(elements(), elements().length(), mGeneration.get());
 	}
 
 	/**
@@ -258,7 +532,77 @@ public:
 	\param[in] value value to append
 	*/
 	inline void push_back(const value_type& value) {
-		mArray.append(value);
+		if (capacity() <= size()) {
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+			growIncrement(size() + 1);
+		}
+		storage().append(value);
+		invalidate();
+	}
+
+	/**
+    Appends "count" copies of the value to the end of the array, growing the
+	array only once.
+
+	\param[in] count number of times the value will be appended
+	\param[in] value value to append
+	*/
+	void append_n(size_type count, const value_type& value) {
+		insert(cend(), count, value);
+	}
+
+	/**
+    Appends a range of values to the end of the array. When the number of
+	values can be measured up front the array grows only once.
+
+	\param[in] first iterator to first value to append
+	\param[in] last iterator to one past the last value to append
+	*/
+	template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+	void append(InputIt first, InputIt last) {
+		insert(cend(), first, last);
+	}
+
+	/**
+    Replaces the contents of the array with "count" copies of the value
+
+	\param[in] count number of elements in the array
+	\param[in] value value to assign to the elements
+	*/
+	void assign(size_type count, const value_type& value) {
+		value_type fillValue(value);
+		if (capacity() < count)
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+		storage().setLength(count);
+		invalidate();
+		fillElements(begin(), count, fillValue, is_raw_copyable());
+	}
+
+	/**
+    Replaces the contents of the array with a range of values. When the number
+	of values can be measured up front the array is sized once and the values
+	are copied in place.
+
+	\param[in] first iterator to first value to assign
+	\param[in] last iterator to one past the last value to assign
+	*/
+	template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+	void assign(InputIt first, InputIt last) {
+		assignRange(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+	}
+
+	/**
+    Grows the array by "count" elements at the end and returns an iterator to
+	the first new element. Like "resize", the new elements are uninitialized
+	and are meant to be assigned through the returned iterator.
+
+	\param[in] count number of elements to add
+
+	\return
+	iterator to the first new element
+	*/
+	iterator grow(size_type count) {
+		return openGap(size(), count);
 	}
 
 	/**
@@ -267,14 +611,103 @@ public:
 	\param[in] value value to insert
 	*/
 	inline void push_front(const value_type& value) {
-		mArray.insert(value, 0);
+		if (capacity() <= size())
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+		MAYAARRAY_COUNT(T, kCountShifts, 1);
+		MAYAARRAY_COUNT(T, kCountElementsShifted, size());
+		storage().insert(value, 0);
+		invalidate();
 	}
 
 	/**
-    Clear the array of all elements
+    Clear the array of all elements. Maya documents that clearing keeps the
+	memory of the array, so the capacity is kept.
 	*/
 	inline void clear() {
-		mArray.clear();
+		mCapacity = capacity();
+		if (mArray)
+			mArray->clear();
+		invalidate();
+	}
+
+	/**
+    Makes sure the array has room for at least "count" elements so that growing
+	the array up to that size reallocates at most once. This does not change the
+	size of the array. Maya does not expose the allocated size of its arrays, so
+	this sets the size increment of the Maya array, the same way growing by the
+	growth factor does, and the room is made the next time the array expands.
+
+	\param[in] count number of elements to make room for
+	*/
+	void reserve(size_type count) {
+		if (capacity() < count) {
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+			storage().setSizeIncrement(count - size());
+			mCapacity = count;
+			++mGrowthCount;
+		}
+	}
+
+	/**
+    Returns the number of elements the array has room for. Maya does not expose
+	the allocated size of its arrays, so this is the capacity that was requested
+	through this class, and never less than the size of the array.
+
+	\return
+	number of elements that can be held without reallocating
+	*/
+	inline size_type capacity() const {
+		return mCapacity < size() ? size() : mCapacity;
+	}
+
+	/**
+    Releases memory that is not used by the elements of the array. Maya does not
+	document whether its arrays release memory when they shrink, so this replaces
+	the Maya array with an exactly sized copy of the elements. The array is
+	unchanged if the copy throws.
+	*/
+	void shrink_to_fit() {
+		if (mArray && size() < capacity()) {
+			MAYAARRAY_COUNT(T, kCountCopies, 1);
+			MAYAARRAY_COUNT(T, kCountBytesCopied, size() * sizeof(value_type));
+			std::unique_ptr<T> shrunk(new T(*mArray));
+			mArray.swap(shrunk);
+			invalidate();
+		}
+		mCapacity = 0;
+	}
+
+	/**
+    Returns the factor the capacity is multiplied by when the array needs to
+	grow. The default is 2.
+
+	\return
+	growth factor
+	*/
+	inline float growth_factor() const {
+		return mGrowthFactor;
+	}
+
+	/**
+    Sets the factor the capacity is multiplied by when the array needs to grow
+	from appending or inserting. A factor of 1 or less turns off geometric growth
+	so the array grows only by the size increment of the Maya array.
+
+	\param[in] factor the growth factor
+	*/
+	inline void set_growth_factor(float factor) {
+		mGrowthFactor = factor;
+	}
+
+	/**
+    Returns how many times this array has grown its capacity. This is useful
+	for checking how many reallocations filling an array performed.
+
+	\return
+	number of capacity increases
+	*/
+	inline size_type growth_count() const {
+		return mGrowthCount;
 	}
 
 	/**
@@ -288,8 +721,13 @@ public:
 	*/
 	iterator insert(const_iterator pos, const value_type& value) {
 		size_type i = pos - begin();
-		mArray.insert(value, i);
-		return iterator(mArray, i);
+		if (capacity() <= size())
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+		MAYAARRAY_COUNT(T, kCountShifts, 1);
+		MAYAARRAY_COUNT(T, kCountElementsShifted, size() - i);
+		storage().insert(value, i);
+		invalidate();
+		return range_type::iteratorAt(elements(), i, mGeneration.get());
 	}
 
 	/**
@@ -304,9 +742,13 @@ public:
 	*/
 	iterator insert(const_iterator pos, size_type count, const value_type& value) {
 		size_type i = pos - begin();
-		while (count--)
-			mArray.insert(value, i);
-		return iterator(mArray, i);
+		if (count) {
+			// the value may be an element of this array, so keep a copy before growing
+			value_type fillValue(value);
+			iterator gap = openGap(i, count);
+			fillElements(gap, count, fillValue, is_raw_copyable());
+		}
+		return range_type::iteratorAt(elements(), i, mGeneration.get());
 	}
 
 	/**
@@ -319,12 +761,11 @@ public:
 	\return
 	iterator at the first inserted value
 	*/
-	template<typename InputIt>
+	template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
 	iterator insert(const_iterator pos, InputIt first, InputIt last) {
 		size_type i = pos - begin();
-		for (size_type p=i; first != last; ++first, ++p)
-			mArray.insert(*first, p);
-		return iterator(mArray, i);
+		insertRange(i, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+		return range_type::iteratorAt(elements(), i, mGeneration.get());
 	}
 
 	/**
@@ -337,8 +778,11 @@ public:
 	*/
 	iterator erase(const_iterator pos) {
 		size_type i = pos - begin();
-		mArray.remove(i);
-		return iterator(mArray, i);
+		MAYAARRAY_COUNT(T, kCountShifts, 1);
+		MAYAARRAY_COUNT(T, kCountElementsShifted, size() - i - 1);
+		storage().remove(i);
+		invalidate();
+		return range_type::iteratorAt(elements(), i, mGeneration.get());
 	}
 
 	/**
@@ -353,9 +797,17 @@ public:
 	*/
 	iterator erase(const_iterator first, const_iterator last) {
 		size_type i = first - begin();
-		for (; first != last; ++first)
-			mArray.remove(i);
-		return iterator(mArray, i);
+		size_type count = last - first;
+		if (count) {
+			// shift the tail down once and truncate instead of removing one at a time
+			size_type oldSize = size();
+			MAYAARRAY_COUNT(T, kCountShifts, 1);
+			MAYAARRAY_COUNT(T, kCountElementsShifted, oldSize - i - count);
+			moveElements(begin() + (i + count), end(), begin() + i, is_raw_copyable());
+			storage().setLength(oldSize - count);
+			invalidate();
+		}
+		return range_type::iteratorAt(elements(), i, mGeneration.get());
 	}
 
 	/**
@@ -366,7 +818,10 @@ public:
 	\param[in] count set the size of the array to this number of elements
 	*/
 	inline void resize(size_type count) {
-		mArray.setLength(count);
+		if (capacity() < count)
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+		storage().setLength(count);
+		invalidate();
 	}
 
 	/**
@@ -380,12 +835,17 @@ public:
 	void resize(size_type count, const value_type& value) {
 		size_type oldSize = size();
 		if (count < oldSize) {
-			mArray.setLength(count);
+			storage().setLength(count);
+			invalidate();
 		}
 		else if (oldSize < count) {
-			mArray.setLength(count);
-			for (size_type i=oldSize; i < count; ++i)
-				mArray[i] = value;
+			// the value may be an element of this array, so keep a copy before growing
+			value_type fillValue(value);
+			if (capacity() < count)
+				MAYAARRAY_COUNT(T, kCountReallocations, 1);
+			storage().setLength(count);
+			invalidate();
+			fillElements(begin() + oldSize, count - oldSize, fillValue, is_raw_copyable());
 		}
 	}
 
@@ -400,9 +860,10 @@ public:
 	reference to element at pos
 	*/
 	reference at(size_type pos) {
-		if (mArray.length() <= pos)
+		if (elements().length() <= pos)
 			throw std::out_of_range("MayaArray out of bounds");
-		return mArray[pos];
+		MAYAARRAY_COUNT(T, kCountDerefs, 1);
+		return elements()[pos];
 	}
 
 	/**
@@ -416,9 +877,10 @@ public:
 	const_reference to element at pos
 	*/
 	const_reference at(size_type pos) const {
-		if (mArray.length() <= pos)
+		if (elements().length() <= pos)
 			throw std::out_of_range("MayaArray out of bounds");
-		return mArray[pos];
+		MAYAARRAY_COUNT(T, kCountDerefs, 1);
+		return elements()[pos];
 	}
 
 	/**
@@ -431,7 +893,8 @@ public:
 	reference to value at pos
 	*/
 	inline reference operator[](size_type pos) {
-		return mArray[pos];
+		MAYAARRAY_COUNT(T, kCountDerefs, 1);
+		return elements()[pos];
 	}
 
 	/**
@@ -444,7 +907,8 @@ public:
 	const_reference to value at pos
 	*/
 	inline const_reference operator[](size_type pos) const {
-		return mArray[pos];
+		MAYAARRAY_COUNT(T, kCountDerefs, 1);
+		return elements()[pos];
 	}
 
 	/**
@@ -494,10 +958,405 @@ public:
 	number of elements in array
 	*/
 	inline size_type size() const {
-		return mArray.length();
+		return elements().length();
+	}
+
+protected:
+	// the Maya array for changing, which is created if there is none yet
+	inline T& storage() {
+		if (!mArray)
+			mArray.reset(new T());
+		return *mArray;
+	}
+
+	// the Maya array for iterating and element access. Arrays without one use a
+	// shared empty array that is never changed, so reading or iterating over
+	// them does not create one.
+	inline T& elements() {
+		return mArray ? *mArray : emptyArray();
+	}
+
+	inline const T& elements() const {
+		return mArray ? *mArray : emptyArray();
+	}
+
+	static T& emptyArray() {
+		static T empty;
+		return empty;
+	}
+
+	// changes the generation so checked iterators created before this are caught when used
+	inline void invalidate() {
+		mGeneration.bump();
+	}
+
+	/**
+    Returns the capacity to grow to so that at least "required" elements fit,
+	following the growth factor.
+
+	\param[in] required minimum number of elements
+
+	\return
+	new capacity
+	*/
+	size_type nextCapacity(size_type required) const {
+		size_type grown = static_cast<size_type>(capacity() * mGrowthFactor);
+		return grown < required ? required : grown;
+	}
+
+	/**
+    Grows the capacity for appending by setting the size increment of the Maya
+	array, so the next time Maya expands the array it makes room for the new
+	capacity in one allocation.
+
+	\param[in] required minimum number of elements
+	*/
+	void growIncrement(size_type required) {
+		if (1.0f < mGrowthFactor) {
+			size_type newCapacity = nextCapacity(required);
+			storage().setSizeIncrement(newCapacity - size());
+			mCapacity = newCapacity;
+			++mGrowthCount;
+		}
+	}
+
+	/**
+    Grows the array once and moves the elements from the given position to the
+	end of the array, leaving a gap of "count" elements to be assigned.
+
+	\param[in] pos index where the gap starts
+	\param[in] count number of elements in the gap
+
+	\return
+	iterator to the first element of the gap
+	*/
+	iterator openGap(size_type pos, size_type count) {
+		size_type oldSize = size();
+		if (capacity() < oldSize + count)
+			reserve(nextCapacity(oldSize + count));
+		storage().setLength(oldSize + count);
+		invalidate();
+		if (pos < oldSize) {
+			MAYAARRAY_COUNT(T, kCountShifts, 1);
+			MAYAARRAY_COUNT(T, kCountElementsShifted, oldSize - pos);
+		}
+		iterator first = begin() + pos;
+		moveElements(first, begin() + oldSize, first + count, is_raw_copyable());
+		return first;
+	}
+
+	// copying from a pointer to plain data elements is a single memcpy
+	template<typename It>
+	struct is_raw_source : std::integral_constant<bool, is_raw_copyable::value && std::is_pointer<It>::value &&
+		std::is_same<typename std::remove_cv<typename std::remove_pointer<It>::type>::type, value_type>::value> {};
+
+	template<typename It>
+	static void copyElements(It first, It last, iterator out, std::true_type) {
+		if (first != last)
+			std::memcpy(static_cast<void*>(&*out), first, (last - first) * sizeof(value_type));
+	}
+
+	template<typename It>
+	static void copyElements(It first, It last, iterator out, std::false_type) {
+		std::copy(first, last, out);
+	}
+
+	// moves the elements to "out", the ranges may overlap
+	static void moveElements(iterator first, iterator last, iterator out, std::true_type) {
+		if (first != last)
+			std::memmove(static_cast<void*>(&*out), &*first, (last - first) * sizeof(value_type));
+	}
+
+	static void moveElements(iterator first, iterator last, iterator out, std::false_type) {
+		if (out < first)
+			std::move(first, last, out);
+		else
+			std::move_backward(first, last, out + (last - first));
+	}
+
+	// values with all bytes zero, such as 0, 0.0 and MVector::zero, are filled with memset
+	static void fillElements(iterator out, size_type count, const value_type& value, std::true_type) {
+		if (!count)
+			return;
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+		bool zero = true;
+		for (std::size_t b = 0; b < sizeof(value_type) && zero; ++b)
+			zero = bytes[b] == 0;
+		if (zero)
+			std::memset(static_cast<void*>(&*out), 0, count * sizeof(value_type));
+		else
+			std::fill_n(out, count, value);
+	}
+
+	static void fillElements(iterator out, size_type count, const value_type& value, std::false_type) {
+		std::fill_n(out, count, value);
+	}
+
+	static T* fromRaw(const value_type* values, size_type count, std::true_type) {
+		return new T(values, count);
+	}
+
+	static T* fromRaw(const value_type* values, size_type count, std::false_type) {
+		std::unique_ptr<T> maya_array(new T());
+		maya_array->setLength(count);
+		for (size_type i = 0; i < count; ++i)
+			(*maya_array)[i] = values[i];
+		return maya_array.release();
+	}
+
+	// the number of elements is known up front so the array only grows once
+	template<typename ForwardIt>
+	void insertRange(size_type pos, ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+		size_type count = static_cast<size_type>(std::distance(first, last));
+		if (count)
+			copyElements(first, last, openGap(pos, count), is_raw_source<ForwardIt>());
+	}
+
+	template<typename ForwardIt>
+	void assignRange(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+		size_type count = static_cast<size_type>(std::distance(first, last));
+		if (capacity() < count)
+			MAYAARRAY_COUNT(T, kCountReallocations, 1);
+		storage().setLength(count);
+		invalidate();
+		copyElements(first, last, begin(), is_raw_source<ForwardIt>());
+	}
+
+	template<typename InputIt>
+	void assignRange(InputIt first, InputIt last, std::input_iterator_tag) {
+		storage().clear();
+		invalidate();
+		for (; first != last; ++first)
+			push_back(*first);
+	}
+
+	// single pass iterators are appended and then rotated into position
+	template<typename InputIt>
+	void insertRange(size_type pos, InputIt first, InputIt last, std::input_iterator_tag) {
+		size_type oldSize = size();
+		for (; first != last; ++first)
+			push_back(*first);
+		std::rotate(begin() + pos, begin() + oldSize, end());
 	}
 };
 
+/**
+MayaArray Back Insert Iterator Class Template
+
+DESCRIPTION:
+An output iterator that appends to a MayaArray, like std::back_insert_iterator.
+It can be given the number of values that will be written so the array is
+grown once before writing. The "copy", "copy_n", "fill_n" and "transform"
+overloads in this namespace take this iterator and grow the array once for the
+whole range, then write the values in place. These are picked up by
+unqualified calls through argument dependent lookup.
+
+USAGE:
+	mayaarray::MayaArray<MPointArray> points;
+
+	// grows the array once and copies the points in place
+	copy(otherPoints.begin(), otherPoints.end(), mayaarray::back_inserter(points));
+
+	// reserves room for "count" weights before they are written one at a time
+	auto out = mayaarray::back_inserter(weights, count);
+	for (unsigned int i = 0; i < count; ++i)
+		*out++ = computeWeight(i);
+*/
+template<typename Container>
+class MayaArrayBackInserter {
+public:
+	typedef std::output_iterator_tag iterator_category;
+	typedef void value_type;
+	typedef void difference_type;
+	typedef void pointer;
+	typedef void reference;
+	typedef Container container_type;
+
+	explicit MayaArrayBackInserter(Container& container) : mContainer(&container) {}
+
+	MayaArrayBackInserter(Container& container, typename Container::size_type expected) : mContainer(&container) {
+		container.reserve(container.size() + expected);
+	}
+
+	MayaArrayBackInserter& operator=(const typename Container::value_type& value) {
+		mContainer->push_back(value);
+		return *this;
+	}
+
+	MayaArrayBackInserter& operator*() {
+		return *this;
+	}
+
+	MayaArrayBackInserter& operator++() {
+		return *this;
+	}
+
+	MayaArrayBackInserter operator++(int) {
+		return *this;
+	}
+
+	/**
+	Returns the array this iterator appends to
+	*/
+	Container& container() const {
+		return *mContainer;
+	}
+
+protected:
+	Container* mContainer;
+};
+
+/**
+Creates a back insert iterator for the array
+
+\param[in] container the array to append to
+
+\return
+back insert iterator
+*/
+template<typename T, typename P>
+inline MayaArrayBackInserter<MayaArray<T, P> > back_inserter(MayaArray<T, P>& container) {
+	return MayaArrayBackInserter<MayaArray<T, P> >(container);
+}
+
+/**
+Creates a back insert iterator for the array that reserves room for the
+expected number of values up front
+
+\param[in] container the array to append to
+\param[in] expected number of values that will be appended
+
+\return
+back insert iterator
+*/
+template<typename T, typename P>
+inline MayaArrayBackInserter<MayaArray<T, P> > back_inserter(MayaArray<T, P>& container, typename MayaArray<T, P>::size_type expected) {
+	return MayaArrayBackInserter<MayaArray<T, P> >(container, expected);
+}
+
+/**
+Copies a range of values to the end of the array, growing it only once when
+the number of values can be measured up front.
+
+\param[in] first iterator to first value to copy
+\param[in] last iterator to one past the last value to copy
+\param[in] out back insert iterator of the array
+
+\return
+the back insert iterator
+*/
+template<typename InputIt, typename T, typename P>
+MayaArrayBackInserter<MayaArray<T, P> > copy(InputIt first, InputIt last, MayaArrayBackInserter<MayaArray<T, P> > out) {
+	out.container().append(first, last);
+	return out;
+}
+
+/**
+Copies "count" values to the end of the array, growing it only once
+
+\param[in] first iterator to first value to copy
+\param[in] count number of values to copy
+\param[in] out back insert iterator of the array
+
+\return
+the back insert iterator
+*/
+template<typename InputIt, typename Size, typename T, typename P>
+MayaArrayBackInserter<MayaArray<T, P> > copy_n(InputIt first, Size count, MayaArrayBackInserter<MayaArray<T, P> > out) {
+	if (0 < count)
+		std::copy_n(first, count, out.container().grow(static_cast<typename MayaArray<T, P>::size_type>(count)));
+	return out;
+}
+
+/**
+Appends "count" copies of the value to the end of the array, growing it only once
+
+\param[in] out back insert iterator of the array
+\param[in] count number of times the value will be appended
+\param[in] value value to append
+
+\return
+the back insert iterator
+*/
+template<typename T, typename P, typename Size, typename U>
+MayaArrayBackInserter<MayaArray<T, P> > fill_n(MayaArrayBackInserter<MayaArray<T, P> > out, Size count, const U& value) {
+	if (0 < count)
+		out.container().append_n(static_cast<typename MayaArray<T, P>::size_type>(count), value);
+	return out;
+}
+
+/**
+Appends the result of applying the operation to each value in the range to the
+end of the array. The array grows only once when the number of values can be
+measured up front, and the results are written in place.
+
+\param[in] first iterator to first value to transform
+\param[in] last iterator to one past the last value to transform
+\param[in] out back insert iterator of the array
+\param[in] op unary operation to apply
+
+\return
+the back insert iterator
+*/
+template<typename InputIt, typename T, typename P, typename UnaryOp>
+MayaArrayBackInserter<MayaArray<T, P> > transform(InputIt first, InputIt last, MayaArrayBackInserter<MayaArray<T, P> > out, UnaryOp op) {
+	typedef typename std::iterator_traits<InputIt>::iterator_category category;
+	if (std::is_base_of<std::forward_iterator_tag, category>::value) {
+		typename MayaArray<T, P>::size_type count = static_cast<typename MayaArray<T, P>::size_type>(std::distance(first, last));
+		std::transform(first, last, out.container().grow(count), op);
+	}
+	else {
+		for (; first != last; ++first)
+			out.container().push_back(op(*first));
+	}
+	return out;
+}
+
+/**
+Exchanges the contents of two MayaArray instances
+
+\param[in] a the first array
+\param[in] b the second array
+*/
+template<typename T, typename P>
+inline void swap(MayaArray<T, P>& a, MayaArray<T, P>& b) {
+	a.swap(b);
+}
+
+/**
+Erases all elements that are equal to the given value from the array in a
+single pass, keeping the order of the remaining elements.
+
+\param[in] container the array to erase from
+\param[in] value the value to compare elements to
+
+\return
+number of elements erased
+*/
+template<typename T, typename P, typename U>
+typename MayaArray<T, P>::size_type erase(MayaArray<T, P>& container, const U& value) {
+	typename MayaArray<T, P>::size_type oldSize = container.size();
+	container.erase(std::remove(container.begin(), container.end(), value), container.end());
+	return oldSize - container.size();
+}
+
+/**
+Erases all elements that satisfy the predicate from the array in a single
+pass, keeping the order of the remaining elements.
+
+\param[in] container the array to erase from
+\param[in] pred unary predicate that returns true for elements to erase
+
+\return
+number of elements erased
+*/
+template<typename T, typename P, typename Pred>
+typename MayaArray<T, P>::size_type erase_if(MayaArray<T, P>& container, Pred pred) {
+	typename MayaArray<T, P>::size_type oldSize = container.size();
+	container.erase(std::remove_if(container.begin(), container.end(), pred), container.end());
+	return oldSize - container.size();
+}
+
 } // namespace mayaarray
 
 #endif // MAYAARRAY_MAYA_ARRAY_H_
\ No newline at end of file
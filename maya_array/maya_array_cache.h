@@ -0,0 +1,669 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_CACHE_H_
+#define MAYAARRAY_MAYA_ARRAY_CACHE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <maya/MApiNamespace.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MStatus.h>
+#include <maya_array/maya_array.h>
+#include <maya_iteration/maya_span.h>
+#include <maya_templates/maya_array_traits.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// LZ4 block compression of the payloads can be enabled by defining
+// MAYAARRAY_CACHE_LZ4 and linking the LZ4 library
+#if defined(MAYAARRAY_CACHE_LZ4)
+#include <lz4.h>
+#endif
+
+namespace mayaarray {
+
+/*
+Cache File Format
+
+A cache file stores arrays by frame and name, such as the points of a mesh for
+each frame of a shot. Values are stored in the byte order of the machine that
+wrote the file, so the payloads can be mapped and used without converting them.
+The byte order is recorded in the header flags, and the reader only opens files
+of its own byte order.
+
+	header        64 bytes, see detail::CacheFileHeader
+	payloads      the elements of each array, starting at a multiple of kCacheAlignment
+	index table   a MayaArrayCacheEntry for each array, sorted by name then frame
+
+The header is written last, so a file that was not closed has no index and is
+rejected by the reader. Files with a newer version than kCacheFormatVersion are
+rejected too.
+*/
+
+// version of the cache file format
+const uint32_t kCacheFormatVersion = 1;
+// payloads start at a multiple of this many bytes
+const uint32_t kCacheAlignment = 64;
+// longest name of an array, including the terminating null
+const uint32_t kCacheNameLength = 32;
+
+// how the payload of an entry is stored
+enum MayaArrayCacheCompression {
+	kCacheUncompressed = 0,
+	kCacheLZ4 = 1
+};
+
+/*
+Entry of the index table of a cache file, which describes one array
+*/
+struct MayaArrayCacheEntry {
+	// the frame the array belongs to
+	double frame;
+	// name of the array, such as "P" for the points
+	char name[kCacheNameLength];
+	// the Maya array type, see cache_type_id
+	uint32_t typeId;
+	// size of an element in bytes
+	uint32_t elementWidth;
+	// number of elements
+	uint32_t count;
+	// a MayaArrayCacheCompression
+	uint32_t compression;
+	// position of the payload in the file
+	uint64_t offset;
+	// size of the payload in the file, which is smaller than count * elementWidth when compressed
+	uint64_t storedSize;
+};
+
+/*
+The type ids stored in the cache for each Maya array type. Only arrays whose
+elements are one block of plain data can be cached.
+*/
+template<typename T>
+struct cache_type_id;
+
+template<> struct cache_type_id<MIntArray> : std::integral_constant<uint32_t, 1> {};
+template<> struct cache_type_id<MUintArray> : std::integral_constant<uint32_t, 2> {};
+template<> struct cache_type_id<MInt64Array> : std::integral_constant<uint32_t, 3> {};
+template<> struct cache_type_id<MFloatArray> : std::integral_constant<uint32_t, 4> {};
+template<> struct cache_type_id<MDoubleArray> : std::integral_constant<uint32_t, 5> {};
+template<> struct cache_type_id<MPointArray> : std::integral_constant<uint32_t, 6> {};
+template<> struct cache_type_id<MFloatPointArray> : std::integral_constant<uint32_t, 7> {};
+template<> struct cache_type_id<MVectorArray> : std::integral_constant<uint32_t, 8> {};
+template<> struct cache_type_id<MFloatVectorArray> : std::integral_constant<uint32_t, 9> {};
+template<> struct cache_type_id<MColorArray> : std::integral_constant<uint32_t, 10> {};
+template<> struct cache_type_id<MMatrixArray> : std::integral_constant<uint32_t, 11> {};
+
+// flags of the cache file header
+enum MayaArrayCacheFlags {
+	// the values in the file are big endian, little endian when not set
+	kCacheBigEndian = 1
+};
+
+namespace detail {
+
+struct CacheFileHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t flags;
+	uint64_t indexOffset;
+	uint32_t entryCount;
+	uint32_t reserved[9];
+};
+
+static_assert(sizeof(CacheFileHeader) == 64, "the cache header must be 64 bytes");
+static_assert(sizeof(MayaArrayCacheEntry) == 72, "the cache entry must be 72 bytes");
+
+const char kCacheMagic[8] = {'M', 'A', 'Y', 'A', 'A', 'R', 'R', 'C'};
+
+// the byte order flag for files written on this machine
+inline uint32_t cacheByteOrderFlag() {
+	const uint16_t one = 1;
+	unsigned char first;
+	std::memcpy(&first, &one, 1);
+	return first ? 0u : static_cast<uint32_t>(kCacheBigEndian);
+}
+
+// index table order
+inline bool cacheEntryLess(const MayaArrayCacheEntry& entry, const char* name, double frame) {
+	const int order = std::strncmp(entry.name, name, kCacheNameLength);
+	return (order < 0 || (order == 0 && entry.frame < frame));
+}
+
+/*
+A read only memory mapping of a whole file
+*/
+class MappedFile {
+public:
+	MappedFile() : mData(nullptr), mSize(0) {
+#if defined(_WIN32)
+		mFile = INVALID_HANDLE_VALUE;
+		mMapping = nullptr;
+#endif
+	}
+
+	~MappedFile() {
+		close();
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const char* path) {
+		close();
+#if defined(_WIN32)
+		mFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (mFile == INVALID_HANDLE_VALUE)
+			return false;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(mFile, &size) || size.QuadPart <= 0) {
+			close();
+			return false;
+		}
+		mSize = static_cast<uint64_t>(size.QuadPart);
+		mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mMapping)
+			mData = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		const int file = ::open(path, O_RDONLY);
+		if (file < 0)
+			return false;
+		struct stat info;
+		if (fstat(file, &info) == 0 && info.st_size > 0) {
+			mSize = static_cast<uint64_t>(info.st_size);
+			void* data = mmap(nullptr, static_cast<size_t>(mSize), PROT_READ, MAP_SHARED, file, 0);
+			if (data != MAP_FAILED)
+				mData = static_cast<const char*>(data);
+		}
+		// the mapping stays valid after the file is closed
+		::close(file);
+#endif
+		if (!mData) {
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	void close() {
+#if defined(_WIN32)
+		if (mData)
+			UnmapViewOfFile(mData);
+		if (mMapping)
+			CloseHandle(mMapping);
+		if (mFile != INVALID_HANDLE_VALUE)
+			CloseHandle(mFile);
+		mFile = INVALID_HANDLE_VALUE;
+		mMapping = nullptr;
+#else
+		if (mData)
+			munmap(const_cast<char*>(mData), static_cast<size_t>(mSize));
+#endif
+		mData = nullptr;
+		mSize = 0;
+	}
+
+	const char* data() const {
+		return mData;
+	}
+
+	uint64_t size() const {
+		return mSize;
+	}
+
+protected:
+	const char* mData;
+	uint64_t mSize;
+#if defined(_WIN32)
+	HANDLE mFile;
+	HANDLE mMapping;
+#endif
+};
+
+} // namespace detail
+
+/**
+Maya Array Cache Writer Class
+
+DESCRIPTION:
+Writes arrays to a cache file by frame and name, see the cache file format
+above. Each array is written with a single call for all of its elements, and
+the index table is written when the writer is closed, which also happens when
+it is destroyed. Only one array can be written for each frame and name.
+
+When built with MAYAARRAY_CACHE_LZ4, the payloads can be compressed with LZ4.
+A payload that does not get smaller is stored uncompressed.
+
+USAGE:
+	mayaarray::MayaArrayCacheWriter writer;
+	MStatus status = writer.open("/shots/sh010/cache/body.mac");
+	for (double frame = start; frame <= end; frame += 1.0) {
+		...
+		writer.write(frame, "P", points);
+		writer.write(frame, "weights", weights);
+	}
+	status = writer.close();
+*/
+class MayaArrayCacheWriter {
+public:
+	MayaArrayCacheWriter() : mFile(nullptr), mOffset(0), mCompress(false) {}
+
+	~MayaArrayCacheWriter() {
+		close();
+	}
+
+	MayaArrayCacheWriter(const MayaArrayCacheWriter&) = delete;
+	MayaArrayCacheWriter& operator=(const MayaArrayCacheWriter&) = delete;
+
+	/**
+	Creates the cache file, replacing a file that exists at the path
+
+	\param[in] path path of the file
+	\param[in] compress compress the payloads with LZ4, which is ignored when built without MAYAARRAY_CACHE_LZ4
+
+	\return
+	kFailure if the file could not be created
+	*/
+	MStatus open(const char* path, bool compress=false) {
+		close();
+		mFile = std::fopen(path, "wb");
+		if (!mFile)
+			return MS::kFailure;
+		mCompress = compress;
+		mOffset = 0;
+		mEntries.clear();
+		// the header is written again with the index when the file is closed
+		const detail::CacheFileHeader header = detail::CacheFileHeader();
+		return writeBytes(&header, sizeof(header));
+	}
+
+	bool isOpen() const {
+		return mFile != nullptr;
+	}
+
+	/**
+	Writes the elements of the array for the frame and name
+
+	\param[in] frame the frame the array belongs to
+	\param[in] name name of the array, shorter than kCacheNameLength
+	\param[in] array the array to write, such as a MayaArray<MPointArray>
+
+	\return
+	kInvalidParameter if the name is too long or was written for the frame already, kFailure if writing failed
+	*/
+	template<typename T, typename P>
+	MStatus write(double frame, const char* name, const MayaArray<T, P>& array) {
+		static_assert(mayatemplates::maya_array_traits<T>::is_raw_copyable::value, "only arrays of plain data can be cached");
+		return writePayload(frame, name, cache_type_id<T>::value, sizeof(typename MayaArray<T, P>::value_type),
+			array.data(), array.size());
+	}
+
+	/**
+	Writes the elements of a Maya array for the frame and name
+
+	\param[in] frame the frame the array belongs to
+	\param[in] name name of the array, shorter than kCacheNameLength
+	\param[in] maya_array the Maya array to write, such as a MPointArray
+
+	\return
+	kInvalidParameter if the name is too long or was written for the frame already, kFailure if writing failed
+	*/
+	template<typename T>
+	typename std::enable_if<mayatemplates::maya_array_traits<T>::is_raw_copyable::value, MStatus>::type write(double frame, const char* name, const T& maya_array) {
+		// the array is only read through the const range
+		const mayaiteration::MayaArrayRange<T> range(const_cast<T&>(maya_array));
+		return writePayload(frame, name, cache_type_id<T>::value, sizeof(typename mayatemplates::maya_array_traits<T>::value_type),
+			range.data(), range.size());
+	}
+
+	/**
+	Writes the index table and the header and closes the file
+
+	\return
+	kFailure if writing failed or the file was not open
+	*/
+	MStatus close() {
+		if (!mFile)
+			return MS::kFailure;
+		MStatus status = pad(8);
+		detail::CacheFileHeader header = detail::CacheFileHeader();
+		std::memcpy(header.magic, detail::kCacheMagic, sizeof(header.magic));
+		header.version = kCacheFormatVersion;
+		header.flags = detail::cacheByteOrderFlag();
+		header.indexOffset = mOffset;
+		header.entryCount = static_cast<uint32_t>(mEntries.size());
+
+		std::sort(mEntries.begin(), mEntries.end(), [](const MayaArrayCacheEntry& a, const MayaArrayCacheEntry& b) {
+			return detail::cacheEntryLess(a, b.name, b.frame);
+		});
+		if (status && !mEntries.empty())
+			status = writeBytes(mEntries.data(), mEntries.size() * sizeof(MayaArrayCacheEntry));
+		if (status && (std::fseek(mFile, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, mFile) != 1))
+			status = MS::kFailure;
+		if (std::fclose(mFile) != 0)
+			status = MS::kFailure;
+		mFile = nullptr;
+		mEntries.clear();
+		return status;
+	}
+
+protected:
+	std::FILE* mFile;
+	uint64_t mOffset;
+	bool mCompress;
+	std::vector<MayaArrayCacheEntry> mEntries;
+	std::vector<char> mCompressed;
+
+	MStatus writeBytes(const void* data, std::size_t size) {
+		if (size && std::fwrite(data, 1, size, mFile) != size)
+			return MS::kFailure;
+		mOffset += size;
+		return MS::kSuccess;
+	}
+
+	// writes zeros up to the next multiple of the alignment
+	MStatus pad(uint64_t alignment) {
+		static const char zeros[kCacheAlignment] = {};
+		const uint64_t remainder = mOffset % alignment;
+		return remainder ? writeBytes(zeros, static_cast<std::size_t>(alignment - remainder)) : MStatus(MS::kSuccess);
+	}
+
+	MStatus writePayload(double frame, const char* name, uint32_t typeId, uint32_t elementWidth, const void* data, uint32_t count) {
+		if (!mFile)
+			return MS::kFailure;
+		if (!name || kCacheNameLength <= std::strlen(name))
+			return MS::kInvalidParameter;
+		for (std::size_t i = 0; i < mEntries.size(); ++i) {
+			if (mEntries[i].frame == frame && std::strncmp(mEntries[i].name, name, kCacheNameLength) == 0)
+				return MS::kInvalidParameter;
+		}
+
+		MStatus status = pad(kCacheAlignment);
+		if (!status)
+			return status;
+		MayaArrayCacheEntry entry = MayaArrayCacheEntry();
+		entry.frame = frame;
+		std::strncpy(entry.name, name, kCacheNameLength - 1);
+		entry.typeId = typeId;
+		entry.elementWidth = elementWidth;
+		entry.count = count;
+		entry.compression = kCacheUncompressed;
+		entry.offset = mOffset;
+		entry.storedSize = static_cast<uint64_t>(count) * elementWidth;
+
+#if defined(MAYAARRAY_CACHE_LZ4)
+		const uint64_t rawSize = entry.storedSize;
+		if (mCompress && rawSize && rawSize <= static_cast<uint64_t>(LZ4_MAX_INPUT_SIZE)) {
+			mCompressed.resize(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(rawSize))));
+			const int compressedSize = LZ4_compress_default(static_cast<const char*>(data), mCompressed.data(),
+				static_cast<int>(rawSize), static_cast<int>(mCompressed.size()));
+			if (compressedSize > 0 && static_cast<uint64_t>(compressedSize) < rawSize) {
+				entry.compression = kCacheLZ4;
+				entry.storedSize = static_cast<uint64_t>(compressedSize);
+				data = mCompressed.data();
+			}
+		}
+#endif
+		status = writeBytes(data, static_cast<std::size_t>(entry.storedSize));
+		if (status)
+			mEntries.push_back(entry);
+		return status;
+	}
+};
+
+/**
+Maya Array Cache Reader Class
+
+DESCRIPTION:
+Reads a cache file written by MayaArrayCacheWriter by mapping it into memory,
+so nothing is read until an array is used and the operating system keeps the
+pages of frames that were read recently. An array is filled with a single copy
+of its payload, or an uncompressed payload can be used in place through a
+MayaSpan over the mapped pages without any copy. Spans are valid until the
+reader is closed.
+
+Arrays are found by frame and name with a binary search of the index table.
+Reading is safe from many threads at once.
+
+USAGE:
+	mayaarray::MayaArrayCacheReader reader;
+	if (!reader.open(path))
+		return MS::kFailure;
+
+	// copy the points of the frame into an array
+	mayaarray::MayaArray<MPointArray> points;
+	MStatus status = reader.read(frame, "P", points);
+
+	// or use them in place
+	mayaiteration::MayaSpan<const MPoint> mapped = reader.span<MPointArray>(frame, "P");
+*/
+class MayaArrayCacheReader {
+public:
+	MayaArrayCacheReader() : mEntries(nullptr), mEntryCount(0) {}
+
+	MayaArrayCacheReader(const MayaArrayCacheReader&) = delete;
+	MayaArrayCacheReader& operator=(const MayaArrayCacheReader&) = delete;
+
+	/**
+	Maps the cache file and checks its header and index table
+
+	\param[in] path path of the file
+
+	\return
+	kFailure if the file could not be mapped or is not a valid cache file
+	*/
+	MStatus open(const char* path) {
+		close();
+		if (!mFile.open(path))
+			return MS::kFailure;
+		const uint64_t size = mFile.size();
+		if (size < sizeof(detail::CacheFileHeader))
+			return fail();
+		detail::CacheFileHeader header;
+		std::memcpy(&header, mFile.data(), sizeof(header));
+		if (std::memcmp(header.magic, detail::kCacheMagic, sizeof(header.magic)) != 0 || kCacheFormatVersion < header.version)
+			return fail();
+		if ((header.flags & kCacheBigEndian) != detail::cacheByteOrderFlag())
+			return fail();
+		const uint64_t indexSize = static_cast<uint64_t>(header.entryCount) * sizeof(MayaArrayCacheEntry);
+		if (header.indexOffset % 8 || size < header.indexOffset || size - header.indexOffset < indexSize)
+			return fail();
+
+		mEntries = reinterpret_cast<const MayaArrayCacheEntry*>(mFile.data() + header.indexOffset);
+		mEntryCount = header.entryCount;
+		for (uint32_t i = 0; i < mEntryCount; ++i) {
+			const MayaArrayCacheEntry& entry = mEntries[i];
+			if (entry.offset % kCacheAlignment || size < entry.offset || size - entry.offset < entry.storedSize ||
+				entry.name[kCacheNameLength - 1] != '\0')
+				return fail();
+			if (entry.compression == kCacheUncompressed && entry.storedSize != static_cast<uint64_t>(entry.count) * entry.elementWidth)
+				return fail();
+		}
+		return MS::kSuccess;
+	}
+
+	/**
+	Unmaps the file, spans returned by the reader are no longer valid
+	*/
+	void close() {
+		mFile.close();
+		mEntries = nullptr;
+		mEntryCount = 0;
+	}
+
+	bool isOpen() const {
+		return mFile.data() != nullptr;
+	}
+
+	/**
+	Returns the number of arrays in the file
+	*/
+	unsigned int entryCount() const {
+		return mEntryCount;
+	}
+
+	/**
+	Returns the entry at the position of the index table, which is sorted by name then frame
+	*/
+	const MayaArrayCacheEntry& entry(unsigned int i) const {
+		assert(i < mEntryCount);
+		return mEntries[i];
+	}
+
+	/**
+	Returns the entry of the array for the frame and name
+
+	\return
+	the entry, or null if there is no such array
+	*/
+	const MayaArrayCacheEntry* find(double frame, const char* name) const {
+		const MayaArrayCacheEntry* last = mEntries + mEntryCount;
+		const MayaArrayCacheEntry* it = std::lower_bound(mEntries, last, 0,
+			[frame, name](const MayaArrayCacheEntry& entry, int) { return detail::cacheEntryLess(entry, name, frame); });
+		if (it == last || it->frame != frame || std::strncmp(it->name, name, kCacheNameLength) != 0)
+			return nullptr;
+		return it;
+	}
+
+	/**
+	Returns the frames that have an array with the name, in ascending order
+	*/
+	MayaArray<MDoubleArray> frames(const char* name) const {
+		MayaArray<MDoubleArray> result;
+		for (unsigned int i = 0; i < mEntryCount; ++i) {
+			if (std::strncmp(mEntries[i].name, name, kCacheNameLength) == 0)
+				result.push_back(mEntries[i].frame);
+		}
+		return result;
+	}
+
+	/**
+	Fills the array with the elements stored for the frame and name. The array
+	keeps its memory when it has room for the elements already, so reading
+	every frame into the same array does not allocate.
+
+	\param[in] frame the frame of the array
+	\param[in] name name of the array
+	\param[out] array the array to fill, of the same type the array was written with
+
+	\return
+	kNotFound if there is no such array, kInvalidParameter if it has another type,
+	kNotImplemented if it is compressed and LZ4 is not enabled, kFailure if it could not be decompressed
+	*/
+	template<typename T, typename P>
+	MStatus read(double frame, const char* name, MayaArray<T, P>& array) const {
+		typedef typename MayaArray<T, P>::value_type value_type;
+		static_assert(mayatemplates::maya_array_traits<T>::is_raw_copyable::value, "only arrays of plain data can be cached");
+		const MayaArrayCacheEntry* entry = find(frame, name);
+		if (!entry)
+			return MS::kNotFound;
+		if (entry->typeId != cache_type_id<T>::value || entry->elementWidth != sizeof(value_type))
+			return MS::kInvalidParameter;
+		const char* payload = mFile.data() + entry->offset;
+
+		if (entry->compression == kCacheUncompressed) {
+			// emptying an array that has to grow keeps Maya from copying the old
+			// elements into the new memory, so the payload is the only copy made
+			if (array.capacity() < entry->count)
+				array.clear();
+			array.resize(entry->count);
+			if (entry->count)
+				std::memcpy(static_cast<void*>(array.data()), payload, static_cast<std::size_t>(entry->storedSize));
+			return MS::kSuccess;
+		}
+#if defined(MAYAARRAY_CACHE_LZ4)
+		if (entry->compression == kCacheLZ4) {
+			const int rawSize = static_cast<int>(static_cast<uint64_t>(entry->count) * entry->elementWidth);
+			if (array.capacity() < entry->count)
+				array.clear();
+			array.resize(entry->count);
+			const int decompressed = LZ4_decompress_safe(payload, reinterpret_cast<char*>(array.data()),
+				static_cast<int>(entry->storedSize), rawSize);
+			if (decompressed != rawSize) {
+				array.clear();
+				return MS::kFailure;
+			}
+			return MS::kSuccess;
+		}
+#endif
+		return MS::kNotImplemented;
+	}
+
+	/**
+	Returns a span over the mapped elements stored for the frame and name,
+	without copying them. The template parameter is the Maya array type the
+	array was written with.
+
+	USAGE:
+		mayaiteration::MayaSpan<const MPoint> points = reader.span<MPointArray>(frame, "P");
+
+	\param[in] frame the frame of the array
+	\param[in] name name of the array
+
+	\return
+	the span, which is empty if there is no such array, it has another type or it is compressed
+	*/
+	template<typename T>
+	mayaiteration::MayaSpan<const typename mayatemplates::maya_array_traits<T>::value_type> span(double frame, const char* name) const {
+		typedef typename mayatemplates::maya_array_traits<T>::value_type value_type;
+		const MayaArrayCacheEntry* entry = find(frame, name);
+		if (!entry || entry->typeId != cache_type_id<T>::value || entry->elementWidth != sizeof(value_type) ||
+			entry->compression != kCacheUncompressed)
+			return mayaiteration::MayaSpan<const value_type>();
+		return mayaiteration::MayaSpan<const value_type>(
+			reinterpret_cast<const value_type*>(mFile.data() + entry->offset), entry->count);
+	}
+
+protected:
+	detail::MappedFile mFile;
+	const MayaArrayCacheEntry* mEntries;
+	uint32_t mEntryCount;
+
+	MStatus fail() {
+		close();
+		return MS::kFailure;
+	}
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_CACHE_H_
@@ -0,0 +1,683 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_KERNELS_H_
+#define MAYAARRAY_MAYA_ARRAY_KERNELS_H_
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <maya/MBoundingBox.h>
+#include <maya/MMatrix.h>
+#include <maya/MPoint.h>
+#include <maya/MVector.h>
+
+// MAYAARRAY_DISABLE_SIMD can be defined to only use the scalar kernels
+#if !defined(MAYAARRAY_DISABLE_SIMD)
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define MAYAARRAY_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MAYAARRAY_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+// functions using AVX2 are compiled for it even when the rest of the plugin is not,
+// and are only called after checking the CPU supports it
+#if defined(MAYAARRAY_KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MAYAARRAY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MAYAARRAY_TARGET_AVX2
+#endif
+
+// the point transform and lerp kernels round each multiply and add on its own
+// and in the same order on every path, so the SIMD and scalar versions give the
+// same results. The compiler is kept from fusing them into FMA instructions,
+// which GCC and Clang otherwise do when FMA is enabled. MSVC only fuses them
+// with /fp:contract or /fp:fast.
+#if defined(__clang__)
+#define MAYAARRAY_NO_FP_CONTRACT
+#define MAYAARRAY_NO_FP_CONTRACT_SCOPE _Pragma("clang fp contract(off)")
+#elif defined(__GNUC__)
+#define MAYAARRAY_NO_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#define MAYAARRAY_NO_FP_CONTRACT_SCOPE
+#else
+#define MAYAARRAY_NO_FP_CONTRACT
+#define MAYAARRAY_NO_FP_CONTRACT_SCOPE
+#endif
+
+namespace mayaarray {
+namespace kernels {
+
+/*
+Instruction sets the kernels can be dispatched to
+*/
+enum SimdLevel {
+	kScalar,
+	kSSE2,
+	kAVX2,
+	kNEON
+};
+
+namespace detail {
+
+// MPoint is four doubles (x, y, z, w) and MVector is three doubles (x, y, z),
+// the kernels work directly on those layouts
+static_assert(sizeof(MPoint) == 4 * sizeof(double), "MPoint is expected to be four doubles");
+static_assert(sizeof(MVector) == 3 * sizeof(double), "MVector is expected to be three doubles");
+
+/*
+Table of the kernels selected for the CPU
+*/
+struct KernelTable {
+	SimdLevel level;
+	void (*transformPoints)(const MPoint* in, MPoint* out, std::size_t count, const MMatrix& matrix);
+	void (*pointBounds)(const MPoint* points, std::size_t count, double* minimum, double* maximum);
+	void (*pointSum)(const MPoint* points, std::size_t count, double* sum);
+	void (*lerp)(const double* a, const double* b, double* out, std::size_t count, double t);
+	void (*doublesToFloats)(const double* in, float* out, std::size_t count);
+	void (*pointsToFloat3)(const MPoint* in, float* out, std::size_t count, std::size_t stride);
+	void (*vectorsToFloat3)(const MVector* in, float* out, std::size_t count, std::size_t stride);
+};
+
+// scalar kernels, these are also used for the remaining elements of the SIMD kernels
+
+MAYAARRAY_NO_FP_CONTRACT inline void transformPointsScalar(const MPoint* in, MPoint* out, std::size_t count, const MMatrix& matrix) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const double (*m)[4] = matrix.matrix;
+	for (std::size_t i = 0; i < count; ++i) {
+		const double x = in[i].x, y = in[i].y, z = in[i].z, w = in[i].w;
+		out[i].x = x * m[0][0] + y * m[1][0] + z * m[2][0] + w * m[3][0];
+		out[i].y = x * m[0][1] + y * m[1][1] + z * m[2][1] + w * m[3][1];
+		out[i].z = x * m[0][2] + y * m[1][2] + z * m[2][2] + w * m[3][2];
+		out[i].w = x * m[0][3] + y * m[1][3] + z * m[2][3] + w * m[3][3];
+	}
+}
+
+inline void pointBoundsScalar(const MPoint* points, std::size_t count, double* minimum, double* maximum) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const double* p = &points[i].x;
+		for (int k = 0; k < 4; ++k) {
+			minimum[k] = p[k] < minimum[k] ? p[k] : minimum[k];
+			maximum[k] = maximum[k] < p[k] ? p[k] : maximum[k];
+		}
+	}
+}
+
+inline void pointSumScalar(const MPoint* points, std::size_t count, double* sum) {
+	for (std::size_t i = 0; i < count; ++i) {
+		sum[0] += points[i].x;
+		sum[1] += points[i].y;
+		sum[2] += points[i].z;
+		sum[3] += points[i].w;
+	}
+}
+
+MAYAARRAY_NO_FP_CONTRACT inline void lerpScalar(const double* a, const double* b, double* out, std::size_t count, double t) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+inline void doublesToFloatsScalar(const double* in, float* out, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = static_cast<float>(in[i]);
+}
+
+// "stride" is the number of floats from one output element to the next
+inline void pointsToFloat3Scalar(const MPoint* in, float* out, std::size_t count, std::size_t stride) {
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		out[0] = static_cast<float>(in[i].x);
+		out[1] = static_cast<float>(in[i].y);
+		out[2] = static_cast<float>(in[i].z);
+	}
+}
+
+inline void vectorsToFloat3Scalar(const MVector* in, float* out, std::size_t count, std::size_t stride) {
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		out[0] = static_cast<float>(in[i].x);
+		out[1] = static_cast<float>(in[i].y);
+		out[2] = static_cast<float>(in[i].z);
+	}
+}
+
+#if defined(MAYAARRAY_KERNELS_X86)
+
+MAYAARRAY_NO_FP_CONTRACT inline void transformPointsSSE2(const MPoint* in, MPoint* out, std::size_t count, const MMatrix& matrix) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const double (*m)[4] = matrix.matrix;
+	const __m128d r0l = _mm_loadu_pd(&m[0][0]), r0h = _mm_loadu_pd(&m[0][2]);
+	const __m128d r1l = _mm_loadu_pd(&m[1][0]), r1h = _mm_loadu_pd(&m[1][2]);
+	const __m128d r2l = _mm_loadu_pd(&m[2][0]), r2h = _mm_loadu_pd(&m[2][2]);
+	const __m128d r3l = _mm_loadu_pd(&m[3][0]), r3h = _mm_loadu_pd(&m[3][2]);
+	for (std::size_t i = 0; i < count; ++i) {
+		const __m128d x = _mm_set1_pd(in[i].x), y = _mm_set1_pd(in[i].y);
+		const __m128d z = _mm_set1_pd(in[i].z), w = _mm_set1_pd(in[i].w);
+		// summed in the order of the scalar version, ((x + y) + z) + w
+		__m128d lo = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(x, r0l), _mm_mul_pd(y, r1l)),
+			_mm_mul_pd(z, r2l)), _mm_mul_pd(w, r3l));
+		__m128d hi = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(x, r0h), _mm_mul_pd(y, r1h)),
+			_mm_mul_pd(z, r2h)), _mm_mul_pd(w, r3h));
+		_mm_storeu_pd(&out[i].x, lo);
+		_mm_storeu_pd(&out[i].z, hi);
+	}
+}
+
+inline void pointBoundsSSE2(const MPoint* points, std::size_t count, double* minimum, double* maximum) {
+	__m128d minLo = _mm_loadu_pd(minimum), minHi = _mm_loadu_pd(minimum + 2);
+	__m128d maxLo = _mm_loadu_pd(maximum), maxHi = _mm_loadu_pd(maximum + 2);
+	for (std::size_t i = 0; i < count; ++i) {
+		const __m128d lo = _mm_loadu_pd(&points[i].x), hi = _mm_loadu_pd(&points[i].z);
+		minLo = _mm_min_pd(minLo, lo);
+		minHi = _mm_min_pd(minHi, hi);
+		maxLo = _mm_max_pd(maxLo, lo);
+		maxHi = _mm_max_pd(maxHi, hi);
+	}
+	_mm_storeu_pd(minimum, minLo);
+	_mm_storeu_pd(minimum + 2, minHi);
+	_mm_storeu_pd(maximum, maxLo);
+	_mm_storeu_pd(maximum + 2, maxHi);
+}
+
+inline void pointSumSSE2(const MPoint* points, std::size_t count, double* sum) {
+	__m128d lo = _mm_loadu_pd(sum), hi = _mm_loadu_pd(sum + 2);
+	for (std::size_t i = 0; i < count; ++i) {
+		lo = _mm_add_pd(lo, _mm_loadu_pd(&points[i].x));
+		hi = _mm_add_pd(hi, _mm_loadu_pd(&points[i].z));
+	}
+	_mm_storeu_pd(sum, lo);
+	_mm_storeu_pd(sum + 2, hi);
+}
+
+MAYAARRAY_NO_FP_CONTRACT inline void lerpSSE2(const double* a, const double* b, double* out, std::size_t count, double t) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const __m128d vt = _mm_set1_pd(t);
+	std::size_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		const __m128d va = _mm_loadu_pd(a + i);
+		const __m128d vb = _mm_loadu_pd(b + i);
+		_mm_storeu_pd(out + i, _mm_add_pd(va, _mm_mul_pd(_mm_sub_pd(vb, va), vt)));
+	}
+	lerpScalar(a + i, b + i, out + i, count - i, t);
+}
+
+inline void doublesToFloatsSSE2(const double* in, float* out, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(in + i));
+		const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(in + i + 2));
+		_mm_storeu_ps(out + i, _mm_movelh_ps(lo, hi));
+	}
+	doublesToFloatsScalar(in + i, out + i, count - i);
+}
+
+// x, y, z and w of the point as floats
+inline __m128 pointToFloat4SSE2(const MPoint& p) {
+	return _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(&p.x)), _mm_cvtpd_ps(_mm_loadu_pd(&p.z)));
+}
+
+// stores x, y and z without touching the float after them
+inline void storeFloat3SSE2(float* out, __m128 p) {
+	_mm_storel_pi(reinterpret_cast<__m64*>(out), p);
+	_mm_store_ss(out + 2, _mm_movehl_ps(p, p));
+}
+
+// stores x, y and z of four points as 12 packed floats, dropping the w components
+inline void storeFloat3x4SSE2(float* out, __m128 p0, __m128 p1, __m128 p2, __m128 p3) {
+	const __m128 z0x1 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 2, 2));
+	const __m128 z2x3 = _mm_shuffle_ps(p2, p3, _MM_SHUFFLE(0, 0, 2, 2));
+	_mm_storeu_ps(out, _mm_shuffle_ps(p0, z0x1, _MM_SHUFFLE(2, 0, 1, 0)));
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 0, 2, 1)));
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(z2x3, p3, _MM_SHUFFLE(2, 1, 2, 0)));
+}
+
+inline void pointsToFloat3SSE2(const MPoint* in, float* out, std::size_t count, std::size_t stride) {
+	std::size_t i = 0;
+	if (stride == 3) {
+		for (; i + 4 <= count; i += 4) {
+			storeFloat3x4SSE2(out + 3 * i, pointToFloat4SSE2(in[i]), pointToFloat4SSE2(in[i + 1]),
+				pointToFloat4SSE2(in[i + 2]), pointToFloat4SSE2(in[i + 3]));
+		}
+	}
+	for (; i < count; ++i)
+		storeFloat3SSE2(out + i * stride, pointToFloat4SSE2(in[i]));
+}
+
+inline void vectorsToFloat3SSE2(const MVector* in, float* out, std::size_t count, std::size_t stride) {
+	// packed vectors are the same doubles in the same order
+	if (stride == 3) {
+		doublesToFloatsSSE2(reinterpret_cast<const double*>(in), out, 3 * count);
+		return;
+	}
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		_mm_storel_pi(reinterpret_cast<__m64*>(out), _mm_cvtpd_ps(_mm_loadu_pd(&in[i].x)));
+		out[2] = static_cast<float>(in[i].z);
+	}
+}
+
+MAYAARRAY_TARGET_AVX2 MAYAARRAY_NO_FP_CONTRACT inline void transformPointsAVX2(const MPoint* in, MPoint* out, std::size_t count, const MMatrix& matrix) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const double (*m)[4] = matrix.matrix;
+	const __m256d r0 = _mm256_loadu_pd(m[0]), r1 = _mm256_loadu_pd(m[1]);
+	const __m256d r2 = _mm256_loadu_pd(m[2]), r3 = _mm256_loadu_pd(m[3]);
+	for (std::size_t i = 0; i < count; ++i) {
+		const __m256d x = _mm256_broadcast_sd(&in[i].x), y = _mm256_broadcast_sd(&in[i].y);
+		const __m256d z = _mm256_broadcast_sd(&in[i].z), w = _mm256_broadcast_sd(&in[i].w);
+		__m256d result = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(x, r0), _mm256_mul_pd(y, r1)),
+			_mm256_mul_pd(z, r2)), _mm256_mul_pd(w, r3));
+		_mm256_storeu_pd(&out[i].x, result);
+	}
+}
+
+MAYAARRAY_TARGET_AVX2 inline void pointBoundsAVX2(const MPoint* points, std::size_t count, double* minimum, double* maximum) {
+	__m256d vmin = _mm256_loadu_pd(minimum), vmax = _mm256_loadu_pd(maximum);
+	for (std::size_t i = 0; i < count; ++i) {
+		const __m256d p = _mm256_loadu_pd(&points[i].x);
+		vmin = _mm256_min_pd(vmin, p);
+		vmax = _mm256_max_pd(vmax, p);
+	}
+	_mm256_storeu_pd(minimum, vmin);
+	_mm256_storeu_pd(maximum, vmax);
+}
+
+MAYAARRAY_TARGET_AVX2 inline void pointSumAVX2(const MPoint* points, std::size_t count, double* sum) {
+	__m256d vsum = _mm256_loadu_pd(sum);
+	for (std::size_t i = 0; i < count; ++i)
+		vsum = _mm256_add_pd(vsum, _mm256_loadu_pd(&points[i].x));
+	_mm256_storeu_pd(sum, vsum);
+}
+
+MAYAARRAY_TARGET_AVX2 MAYAARRAY_NO_FP_CONTRACT inline void lerpAVX2(const double* a, const double* b, double* out, std::size_t count, double t) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const __m256d vt = _mm256_set1_pd(t);
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m256d va = _mm256_loadu_pd(a + i);
+		const __m256d vb = _mm256_loadu_pd(b + i);
+		_mm256_storeu_pd(out + i, _mm256_add_pd(va, _mm256_mul_pd(_mm256_sub_pd(vb, va), vt)));
+	}
+	lerpScalar(a + i, b + i, out + i, count - i, t);
+}
+
+MAYAARRAY_TARGET_AVX2 inline void doublesToFloatsAVX2(const double* in, float* out, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm_storeu_ps(out + i, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+		_mm_storeu_ps(out + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i + 4)));
+	}
+	doublesToFloatsScalar(in + i, out + i, count - i);
+}
+
+MAYAARRAY_TARGET_AVX2 inline void pointsToFloat3AVX2(const MPoint* in, float* out, std::size_t count, std::size_t stride) {
+	std::size_t i = 0;
+	if (stride == 3) {
+		for (; i + 4 <= count; i += 4) {
+			storeFloat3x4SSE2(out + 3 * i, _mm256_cvtpd_ps(_mm256_loadu_pd(&in[i].x)), _mm256_cvtpd_ps(_mm256_loadu_pd(&in[i + 1].x)),
+				_mm256_cvtpd_ps(_mm256_loadu_pd(&in[i + 2].x)), _mm256_cvtpd_ps(_mm256_loadu_pd(&in[i + 3].x)));
+		}
+	}
+	for (; i < count; ++i)
+		storeFloat3SSE2(out + i * stride, _mm256_cvtpd_ps(_mm256_loadu_pd(&in[i].x)));
+}
+
+MAYAARRAY_TARGET_AVX2 inline void vectorsToFloat3AVX2(const MVector* in, float* out, std::size_t count, std::size_t stride) {
+	if (stride == 3) {
+		doublesToFloatsAVX2(reinterpret_cast<const double*>(in), out, 3 * count);
+		return;
+	}
+	vectorsToFloat3SSE2(in, out, count, stride);
+}
+
+inline bool cpuSupportsAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+	__cpuid(info, 1);
+	// the OS must also save the AVX registers on context switches
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	if (!osxsave || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif // MAYAARRAY_KERNELS_X86
+
+#if defined(MAYAARRAY_KERNELS_NEON)
+
+MAYAARRAY_NO_FP_CONTRACT inline void transformPointsNEON(const MPoint* in, MPoint* out, std::size_t count, const MMatrix& matrix) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	const double (*m)[4] = matrix.matrix;
+	const float64x2_t r0l = vld1q_f64(&m[0][0]), r0h = vld1q_f64(&m[0][2]);
+	const float64x2_t r1l = vld1q_f64(&m[1][0]), r1h = vld1q_f64(&m[1][2]);
+	const float64x2_t r2l = vld1q_f64(&m[2][0]), r2h = vld1q_f64(&m[2][2]);
+	const float64x2_t r3l = vld1q_f64(&m[3][0]), r3h = vld1q_f64(&m[3][2]);
+	for (std::size_t i = 0; i < count; ++i) {
+		const double x = in[i].x, y = in[i].y, z = in[i].z, w = in[i].w;
+		// summed in the order of the scalar version, ((x + y) + z) + w
+		float64x2_t lo = vaddq_f64(vaddq_f64(vaddq_f64(vmulq_n_f64(r0l, x), vmulq_n_f64(r1l, y)),
+			vmulq_n_f64(r2l, z)), vmulq_n_f64(r3l, w));
+		float64x2_t hi = vaddq_f64(vaddq_f64(vaddq_f64(vmulq_n_f64(r0h, x), vmulq_n_f64(r1h, y)),
+			vmulq_n_f64(r2h, z)), vmulq_n_f64(r3h, w));
+		vst1q_f64(&out[i].x, lo);
+		vst1q_f64(&out[i].z, hi);
+	}
+}
+
+inline void pointBoundsNEON(const MPoint* points, std::size_t count, double* minimum, double* maximum) {
+	float64x2_t minLo = vld1q_f64(minimum), minHi = vld1q_f64(minimum + 2);
+	float64x2_t maxLo = vld1q_f64(maximum), maxHi = vld1q_f64(maximum + 2);
+	for (std::size_t i = 0; i < count; ++i) {
+		const float64x2_t lo = vld1q_f64(&points[i].x), hi = vld1q_f64(&points[i].z);
+		minLo = vminq_f64(minLo, lo);
+		minHi = vminq_f64(minHi, hi);
+		maxLo = vmaxq_f64(maxLo, lo);
+		maxHi = vmaxq_f64(maxHi, hi);
+	}
+	vst1q_f64(minimum, minLo);
+	vst1q_f64(minimum + 2, minHi);
+	vst1q_f64(maximum, maxLo);
+	vst1q_f64(maximum + 2, maxHi);
+}
+
+inline void pointSumNEON(const MPoint* points, std::size_t count, double* sum) {
+	float64x2_t lo = vld1q_f64(sum), hi = vld1q_f64(sum + 2);
+	for (std::size_t i = 0; i < count; ++i) {
+		lo = vaddq_f64(lo, vld1q_f64(&points[i].x));
+		hi = vaddq_f64(hi, vld1q_f64(&points[i].z));
+	}
+	vst1q_f64(sum, lo);
+	vst1q_f64(sum + 2, hi);
+}
+
+MAYAARRAY_NO_FP_CONTRACT inline void lerpNEON(const double* a, const double* b, double* out, std::size_t count, double t) {
+	MAYAARRAY_NO_FP_CONTRACT_SCOPE
+	std::size_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		const float64x2_t va = vld1q_f64(a + i);
+		const float64x2_t vb = vld1q_f64(b + i);
+		vst1q_f64(out + i, vaddq_f64(va, vmulq_n_f64(vsubq_f64(vb, va), t)));
+	}
+	lerpScalar(a + i, b + i, out + i, count - i, t);
+}
+
+inline void doublesToFloatsNEON(const double* in, float* out, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const float32x2_t lo = vcvt_f32_f64(vld1q_f64(in + i));
+		vst1q_f32(out + i, vcvt_high_f32_f64(lo, vld1q_f64(in + i + 2)));
+	}
+	doublesToFloatsScalar(in + i, out + i, count - i);
+}
+
+inline void pointsToFloat3NEON(const MPoint* in, float* out, std::size_t count, std::size_t stride) {
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		vst1_f32(out, vcvt_f32_f64(vld1q_f64(&in[i].x)));
+		out[2] = static_cast<float>(in[i].z);
+	}
+}
+
+inline void vectorsToFloat3NEON(const MVector* in, float* out, std::size_t count, std::size_t stride) {
+	if (stride == 3) {
+		doublesToFloatsNEON(reinterpret_cast<const double*>(in), out, 3 * count);
+		return;
+	}
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		vst1_f32(out, vcvt_f32_f64(vld1q_f64(&in[i].x)));
+		out[2] = static_cast<float>(in[i].z);
+	}
+}
+
+#endif // MAYAARRAY_KERNELS_NEON
+
+inline KernelTable selectKernels() {
+	KernelTable table = { kScalar, &transformPointsScalar, &pointBoundsScalar, &pointSumScalar, &lerpScalar,
+		&doublesToFloatsScalar, &pointsToFloat3Scalar, &vectorsToFloat3Scalar };
+#if defined(MAYAARRAY_KERNELS_X86)
+	if (cpuSupportsAVX2()) {
+		KernelTable avx2 = { kAVX2, &transformPointsAVX2, &pointBoundsAVX2, &pointSumAVX2, &lerpAVX2,
+			&doublesToFloatsAVX2, &pointsToFloat3AVX2, &vectorsToFloat3AVX2 };
+		table = avx2;
+	}
+	else {
+		KernelTable sse2 = { kSSE2, &transformPointsSSE2, &pointBoundsSSE2, &pointSumSSE2, &lerpSSE2,
+			&doublesToFloatsSSE2, &pointsToFloat3SSE2, &vectorsToFloat3SSE2 };
+		table = sse2;
+	}
+#elif defined(MAYAARRAY_KERNELS_NEON)
+	KernelTable neon = { kNEON, &transformPointsNEON, &pointBoundsNEON, &pointSumNEON, &lerpNEON,
+		&doublesToFloatsNEON, &pointsToFloat3NEON, &vectorsToFloat3NEON };
+	table = neon;
+#endif
+	return table;
+}
+
+// the CPU is checked once and the selected kernels are reused after that
+inline const KernelTable& kernelTable() {
+	static const KernelTable table = selectKernels();
+	return table;
+}
+
+// returns the element pointer of a contiguous range such as a MayaArray,
+// MayaArrayRange or a raw pointer range, checking the element type
+template<typename E, typename Range>
+inline E* elements(Range& range) {
+	static_assert(std::is_same<typename std::remove_const<typename std::remove_pointer<decltype(range.data())>::type>::type,
+		typename std::remove_const<E>::type>::value, "Range has the wrong element type for this kernel");
+	return range.data();
+}
+
+} // namespace detail
+
+/**
+Returns the instruction set the kernels were dispatched to on this CPU
+
+\return
+SIMD level used by the kernels
+*/
+inline SimdLevel simdLevel() {
+	return detail::kernelTable().level;
+}
+
+/**
+Transforms all points of the range by the matrix in place, the same as
+multiplying each MPoint by the MMatrix.
+
+\param[in,out] points contiguous range of MPoint, such as a MayaArray<MPointArray>
+\param[in] matrix the transformation matrix
+*/
+template<typename PointRange>
+void transformPoints(PointRange&& points, const MMatrix& matrix) {
+	MPoint* p = detail::elements<MPoint>(points);
+	detail::kernelTable().transformPoints(p, p, points.size(), matrix);
+}
+
+/**
+Transforms all points of the input range by the matrix and stores them in the
+output range. The output must already have the same size as the input, and may
+be the same range as the input.
+
+\param[in] in contiguous range of MPoint to transform
+\param[out] out contiguous range of MPoint for the results
+\param[in] matrix the transformation matrix
+*/
+template<typename InRange, typename OutRange>
+void transformPoints(const InRange& in, OutRange&& out, const MMatrix& matrix) {
+	assert(in.size() == out.size());
+	detail::kernelTable().transformPoints(detail::elements<const MPoint>(in), detail::elements<MPoint>(out), in.size(), matrix);
+}
+
+/**
+Returns the bounding box of all points in the range. The points are expected
+to be cartesian, the w component is ignored.
+
+\param[in] points contiguous range of MPoint
+
+\return
+the bounding box, which is empty if the range is empty
+*/
+template<typename PointRange>
+MBoundingBox boundingBox(const PointRange& points) {
+	if (points.size() == 0)
+		return MBoundingBox();
+	const MPoint* p = detail::elements<const MPoint>(points);
+	double minimum[4] = { p[0].x, p[0].y, p[0].z, p[0].w };
+	double maximum[4] = { p[0].x, p[0].y, p[0].z, p[0].w };
+	detail::kernelTable().pointBounds(p + 1, points.size() - 1, minimum, maximum);
+	return MBoundingBox(MPoint(minimum[0], minimum[1], minimum[2]), MPoint(maximum[0], maximum[1], maximum[2]));
+}
+
+/**
+Returns the average position of all points in the range. The points are
+expected to be cartesian, the w component is ignored.
+
+\param[in] points contiguous range of MPoint
+
+\return
+the centroid, or the origin if the range is empty
+*/
+template<typename PointRange>
+MPoint centroid(const PointRange& points) {
+	if (points.size() == 0)
+		return MPoint();
+	double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+	detail::kernelTable().pointSum(detail::elements<const MPoint>(points), points.size(), sum);
+	const double scale = 1.0 / points.size();
+	return MPoint(sum[0] * scale, sum[1] * scale, sum[2] * scale);
+}
+
+/**
+Linearly blends between two point ranges, storing a + (b - a) * t in the output
+range. All ranges must have the same size and the output may be one of the inputs.
+
+\param[in] a contiguous range of MPoint at t = 0
+\param[in] b contiguous range of MPoint at t = 1
+\param[in] t blend weight
+\param[out] out contiguous range of MPoint for the results
+*/
+template<typename RangeA, typename RangeB, typename OutRange>
+void lerpPoints(const RangeA& a, const RangeB& b, double t, OutRange&& out) {
+	assert(a.size() == b.size() && a.size() == out.size());
+	if (a.size() == 0)
+		return;
+	detail::kernelTable().lerp(&detail::elements<const MPoint>(a)->x, &detail::elements<const MPoint>(b)->x,
+		&detail::elements<MPoint>(out)->x, 4 * static_cast<std::size_t>(a.size()), t);
+}
+
+/**
+Linearly blends between two vector ranges, storing a + (b - a) * t in the
+output range. All ranges must have the same size and the output may be one of
+the inputs.
+
+\param[in] a contiguous range of MVector at t = 0
+\param[in] b contiguous range of MVector at t = 1
+\param[in] t blend weight
+\param[out] out contiguous range of MVector for the results
+*/
+template<typename RangeA, typename RangeB, typename OutRange>
+void lerpVectors(const RangeA& a, const RangeB& b, double t, OutRange&& out) {
+	assert(a.size() == b.size() && a.size() == out.size());
+	if (a.size() == 0)
+		return;
+	detail::kernelTable().lerp(&detail::elements<const MVector>(a)->x, &detail::elements<const MVector>(b)->x,
+		&detail::elements<MVector>(out)->x, 3 * static_cast<std::size_t>(a.size()), t);
+}
+
+/**
+Normalizes all vectors in the range in place. Vectors with zero length are left
+unchanged, the same as MVector::normalize.
+
+\param[in,out] vectors contiguous range of MVector
+*/
+template<typename VectorRange>
+void normalizeVectors(VectorRange&& vectors) {
+	MVector* v = detail::elements<MVector>(vectors);
+	const std::size_t count = vectors.size();
+	for (std::size_t i = 0; i < count; ++i) {
+		const double lengthSquared = v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z;
+		const double scale = 0.0 < lengthSquared ? 1.0 / std::sqrt(lengthSquared) : 1.0;
+		v[i].x *= scale;
+		v[i].y *= scale;
+		v[i].z *= scale;
+	}
+}
+
+/**
+Computes the dot product of each pair of vectors from two ranges. All ranges
+must have the same size.
+
+\param[in] a contiguous range of MVector
+\param[in] b contiguous range of MVector
+\param[out] out contiguous range of double for the results, such as a MayaArray<MDoubleArray>
+*/
+template<typename RangeA, typename RangeB, typename OutRange>
+void dotProducts(const RangeA& a, const RangeB& b, OutRange&& out) {
+	assert(a.size() == b.size() && a.size() == out.size());
+	const MVector* va = detail::elements<const MVector>(a);
+	const MVector* vb = detail::elements<const MVector>(b);
+	double* result = detail::elements<double>(out);
+	const std::size_t count = a.size();
+	for (std::size_t i = 0; i < count; ++i)
+		result[i] = va[i].x * vb[i].x + va[i].y * vb[i].y + va[i].z * vb[i].z;
+}
+
+/**
+Computes the cross product of each pair of vectors from two ranges. All ranges
+must have the same size and the output may be one of the inputs.
+
+\param[in] a contiguous range of MVector
+\param[in] b contiguous range of MVector
+\param[out] out contiguous range of MVector for the results
+*/
+template<typename RangeA, typename RangeB, typename OutRange>
+void crossProducts(const RangeA& a, const RangeB& b, OutRange&& out) {
+	assert(a.size() == b.size() && a.size() == out.size());
+	const MVector* va = detail::elements<const MVector>(a);
+	const MVector* vb = detail::elements<const MVector>(b);
+	MVector* result = detail::elements<MVector>(out);
+	const std::size_t count = a.size();
+	for (std::size_t i = 0; i < count; ++i) {
+		const double x = va[i].y * vb[i].z - va[i].z * vb[i].y;
+		const double y = va[i].z * vb[i].x - va[i].x * vb[i].z;
+		const double z = va[i].x * vb[i].y - va[i].y * vb[i].x;
+		result[i].x = x;
+		result[i].y = y;
+		result[i].z = z;
+	}
+}
+
+} // namespace kernels
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_KERNELS_H_
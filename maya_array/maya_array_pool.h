@@ -0,0 +1,338 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_POOL_H_
+#define MAYAARRAY_MAYA_ARRAY_POOL_H_
+
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <maya_array/maya_array.h>
+
+namespace mayaarray {
+
+template<typename T>
+class MayaArrayPool;
+
+/*
+Usage counters of a MayaArrayPool
+*/
+struct MayaArrayPoolStats {
+	// number of leases made
+	unsigned int leases;
+	// number of leases that had to allocate a new array
+	unsigned int allocations;
+	// number of arrays leased right now
+	unsigned int outstanding;
+	// the most arrays that were leased at the same time
+	unsigned int peakOutstanding;
+	// the most elements that the leased arrays had room for at the same time
+	unsigned int peakElements;
+	// number of free arrays kept by the pool
+	unsigned int retained;
+};
+
+/**
+Maya Array Lease Class Template
+
+DESCRIPTION:
+Holds an array leased from a MayaArrayPool and gives it back to the pool when
+it goes out of scope or is reset. The lease can be moved but not copied. The
+array is used through the lease like a pointer.
+*/
+template<typename T>
+class MayaArrayLease {
+friend class MayaArrayPool<T>;
+
+public:
+	MayaArrayLease() : mPool(nullptr), mLeasedCapacity(0) {}
+
+	MayaArrayLease(MayaArrayLease&& other)
+		: mPool(other.mPool), mArray(std::move(other.mArray)), mLeasedCapacity(other.mLeasedCapacity) {
+		other.mPool = nullptr;
+	}
+
+	MayaArrayLease& operator=(MayaArrayLease&& other) {
+		if (this != &other) {
+			reset();
+			mPool = other.mPool;
+			mArray = std::move(other.mArray);
+			mLeasedCapacity = other.mLeasedCapacity;
+			other.mPool = nullptr;
+		}
+		return *this;
+	}
+
+	MayaArrayLease(const MayaArrayLease&) = delete;
+	MayaArrayLease& operator=(const MayaArrayLease&) = delete;
+
+	~MayaArrayLease() {
+		reset();
+	}
+
+	/**
+    Gives the array back to the pool before the lease goes out of scope
+	*/
+	void reset() {
+		if (mArray) {
+			mPool->giveBack(std::move(mArray), mLeasedCapacity);
+			mPool = nullptr;
+		}
+	}
+
+	MayaArray<T>* get() const {
+		return mArray.get();
+	}
+
+	MayaArray<T>& operator*() const {
+		assert(mArray);
+		return *mArray;
+	}
+
+	MayaArray<T>* operator->() const {
+		assert(mArray);
+		return mArray.get();
+	}
+
+	explicit operator bool() const {
+		return mArray != nullptr;
+	}
+
+protected:
+	MayaArrayPool<T>* mPool;
+	std::unique_ptr<MayaArray<T>> mArray;
+	unsigned int mLeasedCapacity;
+
+	MayaArrayLease(MayaArrayPool<T>& pool, std::unique_ptr<MayaArray<T>>&& array)
+		: mPool(&pool), mArray(std::move(array)), mLeasedCapacity(mArray->capacity()) {}
+};
+
+/**
+Maya Array Pool Class Template
+
+DESCRIPTION:
+Keeps arrays that are used as temporary storage, so that they do not need to be
+allocated and freed on every evaluation. Arrays are leased with a number of
+elements they need room for and are given back when the lease goes out of
+scope. They are cleared when they are given back but keep their memory, and
+are sorted into size classes by powers of two so a lease gets an array that
+already has enough room.
+
+A pool is not thread safe. Each thread can use its own pool through "local",
+or a node can keep a pool as a member for its compute method. A lease must be
+given back on the thread that made it and before the pool is destroyed.
+
+USAGE:
+	MStatus MyDeformer::deform(MDataBlock& data, MItGeometry& iter, const MMatrix& m, unsigned int multiIndex) {
+		mayaarray::MayaArrayLease<MFloatArray> weights = mayaarray::MayaArrayPool<MFloatArray>::local().lease(iter.count());
+		weights->resize(iter.count());
+		...
+	} // weights are given back here and reused by the next evaluation on this thread
+*/
+template<typename T>
+class MayaArrayPool {
+friend class MayaArrayLease<T>;
+
+public:
+	typedef typename MayaArray<T>::size_type size_type;
+	typedef MayaArrayLease<T> lease_type;
+
+	// number of elements of the smallest size class
+	static const size_type kMinClassSize = 64;
+	// number of size classes, larger arrays are kept in the last class
+	static const size_type kClassCount = 20;
+
+	/**
+    Creates an empty pool
+
+	\param[in] maxRetained most free arrays kept in each size class
+	*/
+	explicit MayaArrayPool(size_type maxRetained=8) : mMaxRetained(maxRetained), mOutstandingElements(0) {
+		mStats = MayaArrayPoolStats();
+		mFree.resize(kClassCount);
+	}
+
+	MayaArrayPool(const MayaArrayPool&) = delete;
+	MayaArrayPool& operator=(const MayaArrayPool&) = delete;
+
+	~MayaArrayPool() {
+		assert(mStats.outstanding == 0 && "arrays are still leased from the pool");
+	}
+
+	/**
+    Returns the pool of the calling thread
+	*/
+	static MayaArrayPool& local() {
+		static thread_local MayaArrayPool pool;
+		return pool;
+	}
+
+	/**
+    Leases an empty array that has room for at least "count" elements
+
+	\param[in] count number of elements the array needs room for
+
+	\return
+	lease of the array
+	*/
+	lease_type lease(size_type count) {
+		const size_type sizeClass = classFor(count);
+		std::unique_ptr<MayaArray<T>> array;
+		// use a larger free array when there is none of this size, such as one
+		// that grew while it was leased
+		for (size_type c = sizeClass; c < kClassCount && !array; ++c) {
+			std::vector<std::unique_ptr<MayaArray<T>>>& free = mFree[c];
+			// the last class holds arrays of any larger size, so check they have room
+			for (size_type i = free.size(); i-- > 0;) {
+				if (count <= free[i]->capacity()) {
+					array = std::move(free[i]);
+					free[i] = std::move(free.back());
+					free.pop_back();
+					--mStats.retained;
+					break;
+				}
+			}
+		}
+		if (!array) {
+			array.reset(new MayaArray<T>());
+			array->reserve(count < classSize(sizeClass) ? classSize(sizeClass) : count);
+			++mStats.allocations;
+		}
+
+		++mStats.leases;
+		++mStats.outstanding;
+		mOutstandingElements += array->capacity();
+		if (mStats.peakOutstanding < mStats.outstanding)
+			mStats.peakOutstanding = mStats.outstanding;
+		if (mStats.peakElements < mOutstandingElements)
+			mStats.peakElements = mOutstandingElements;
+		return lease_type(*this, std::move(array));
+	}
+
+	/**
+    Frees all arrays the pool keeps, leased arrays are not affected
+	*/
+	void trim() {
+		for (size_type i = 0; i < kClassCount; ++i)
+			mFree[i].clear();
+		mStats.retained = 0;
+	}
+
+	/**
+    Returns the usage counters of the pool
+	*/
+	const MayaArrayPoolStats& stats() const {
+		return mStats;
+	}
+
+	/**
+    Resets the counters of leases, allocations and peaks, keeping the current
+	number of outstanding and retained arrays
+	*/
+	void resetStats() {
+		MayaArrayPoolStats current = MayaArrayPoolStats();
+		current.outstanding = mStats.outstanding;
+		current.peakOutstanding = mStats.outstanding;
+		current.peakElements = mOutstandingElements;
+		current.retained = mStats.retained;
+		mStats = current;
+	}
+
+	/**
+    Sets the most free arrays kept in each size class, extra arrays are freed
+	when they are given back
+	*/
+	void setMaxRetained(size_type maxRetained) {
+		mMaxRetained = maxRetained;
+	}
+
+	size_type maxRetained() const {
+		return mMaxRetained;
+	}
+
+protected:
+	std::vector<std::vector<std::unique_ptr<MayaArray<T>>>> mFree;
+	MayaArrayPoolStats mStats;
+	size_type mMaxRetained;
+	size_type mOutstandingElements;
+
+	static size_type classSize(size_type sizeClass) {
+		return kMinClassSize << sizeClass;
+	}
+
+	// smallest class whose arrays have room for "count" elements
+	static size_type classFor(size_type count) {
+		size_type sizeClass = 0;
+		while (sizeClass + 1 < kClassCount && classSize(sizeClass) < count)
+			++sizeClass;
+		return sizeClass;
+	}
+
+	// largest class that an array with "capacity" elements has room for
+	static size_type classOf(size_type capacity) {
+		size_type sizeClass = 0;
+		while (sizeClass + 1 < kClassCount && classSize(sizeClass + 1) <= capacity)
+			++sizeClass;
+		return sizeClass;
+	}
+
+	void giveBack(std::unique_ptr<MayaArray<T>>&& array, size_type leasedCapacity) {
+		assert(mStats.outstanding);
+		--mStats.outstanding;
+		mOutstandingElements -= leasedCapacity;
+		// the array may have grown while it was leased
+		const size_type capacity = array->capacity();
+		std::vector<std::unique_ptr<MayaArray<T>>>& free = mFree[classOf(capacity)];
+		if (free.size() < mMaxRetained && kMinClassSize <= capacity) {
+			// clearing keeps the memory of the Maya array and the capacity of
+			// the MayaArray, so the array can be leased again for this class
+			array->clear();
+			assert(array->capacity() == capacity);
+			free.push_back(std::move(array));
+			++mStats.retained;
+		}
+	}
+};
+
+/**
+Leases an empty array with room for at least "count" elements from the pool of
+the calling thread
+
+USAGE:
+	auto indices = mayaarray::leaseArray<MIntArray>(count);
+	indices->push_back(0);
+
+\param[in] count number of elements the array needs room for
+
+\return
+lease of the array
+*/
+template<typename T>
+inline MayaArrayLease<T> leaseArray(typename MayaArray<T>::size_type count) {
+	return MayaArrayPool<T>::local().lease(count);
+}
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_POOL_H_
@@ -0,0 +1,250 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_SOA_H_
+#define MAYAARRAY_MAYA_ARRAY_SOA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <maya_array/maya_array.h>
+
+namespace mayaarray {
+
+/**
+Maya Array Structure of Arrays Class Template
+
+DESCRIPTION:
+Maya's point and vector arrays store each element as an array of structures,
+so the x, y, z (and w) components of one element are next to each other. Many
+solvers vectorize better when each component is in its own contiguous lane.
+This class copies the components of a MPointArray, MFloatPointArray, MVectorArray
+or MFloatVectorArray into separate lanes that are aligned to "alignment" bytes,
+and writes them back to a Maya array with "commit". The lanes keep their memory
+between loads so an instance can be reused across evaluations without
+reallocating.
+
+The w lane is only kept when asked for. When it is not kept, "commit" leaves the
+w component of existing points unchanged and sets it to 1 for new points.
+
+USAGE:
+	// a member of the deformer so the lanes are reused on every evaluation
+	mayaarray::MayaArraySoA<MPointArray> lanes;
+
+	lanes.load(points);
+	double* x = lanes.x();
+	double* y = lanes.y();
+	for (unsigned int i = 0; i < lanes.size(); ++i)
+		y[i] += std::sin(x[i]);
+	lanes.commit(points);
+*/
+template<typename T>
+class MayaArraySoA {
+public:
+	typedef typename std::remove_reference<decltype(std::declval<T&>()[0])>::type element_type;
+	typedef typename std::remove_reference<decltype(std::declval<element_type&>().x)>::type scalar_type;
+	typedef unsigned int size_type;
+
+	// number of components in each element, 4 for points and 3 for vectors
+	static const size_type components = sizeof(element_type) / sizeof(scalar_type);
+	// byte alignment of each lane
+	static const std::size_t alignment = 64;
+
+	static_assert(components == 3 || components == 4, "MayaArraySoA only supports point and vector arrays");
+
+	/**
+    Creates empty lanes
+
+	\param[in] withW keep a lane for the w component of points
+	*/
+	explicit MayaArraySoA(bool withW=false) : mSize(0), mStride(0), mHasW(withW && components == 4) {}
+
+	/**
+    Copies the components of all elements from a Maya array into the lanes
+
+	\param[in] maya_array the Maya array to copy from
+	*/
+	void load(const T& maya_array) {
+		load(maya_array.length() ? &maya_array[0] : nullptr, maya_array.length());
+	}
+
+	/**
+    Copies the components of all elements from a MayaArray into the lanes
+
+	\param[in] array the array to copy from
+	*/
+	template<typename P>
+	void load(const MayaArray<T, P>& array) {
+		load(array.array());
+	}
+
+	/**
+    Copies the components of "count" elements into the lanes
+
+	\param[in] elements pointer to the first element
+	\param[in] count number of elements
+	*/
+	void load(const element_type* elements, size_type count) {
+		resize(count);
+		scalar_type* lx = x();
+		scalar_type* ly = y();
+		scalar_type* lz = z();
+		for (size_type i = 0; i < count; ++i) {
+			const scalar_type* e = &elements[i].x;
+			lx[i] = e[0];
+			ly[i] = e[1];
+			lz[i] = e[2];
+		}
+		if (mHasW) {
+			scalar_type* lw = w();
+			for (size_type i = 0; i < count; ++i)
+				lw[i] = (&elements[i].x)[3];
+		}
+	}
+
+	/**
+    Writes the lanes back to a Maya array, resizing it to match the lanes
+
+	\param[out] maya_array the Maya array to write to
+	*/
+	void commit(T& maya_array) const {
+		size_type oldSize = maya_array.length();
+		if (oldSize != mSize)
+			maya_array.setLength(mSize);
+		if (mSize)
+			commit(&maya_array[0], oldSize);
+	}
+
+	/**
+    Writes the lanes back to a MayaArray, resizing it to match the lanes
+
+	\param[out] array the array to write to
+	*/
+	template<typename P>
+	void commit(MayaArray<T, P>& array) const {
+		commit(array.array());
+	}
+
+	/**
+    Sets the number of elements in the lanes without copying any data, for
+	when the lanes are filled by the caller. Existing memory is reused.
+
+	\param[in] count number of elements
+	*/
+	void resize(size_type count) {
+		const std::size_t perLine = alignment / sizeof(scalar_type);
+		mSize = count;
+		mStride = (count + perLine - 1) / perLine * perLine;
+		mBuffer.resize(mStride * lanes() + perLine);
+	}
+
+	/**
+    Returns the number of elements in the lanes
+	*/
+	inline size_type size() const {
+		return mSize;
+	}
+
+	/**
+    Returns true if the w component has its own lane
+	*/
+	inline bool hasW() const {
+		return mHasW;
+	}
+
+	inline scalar_type* x() { return lane(0); }
+	inline scalar_type* y() { return lane(1); }
+	inline scalar_type* z() { return lane(2); }
+	inline const scalar_type* x() const { return lane(0); }
+	inline const scalar_type* y() const { return lane(1); }
+	inline const scalar_type* z() const { return lane(2); }
+
+	/**
+    Returns the w lane, only available when the lanes were created with w
+	*/
+	inline scalar_type* w() {
+		return mHasW ? lane(3) : nullptr;
+	}
+
+	inline const scalar_type* w() const {
+		return mHasW ? lane(3) : nullptr;
+	}
+
+	/**
+    Returns the lane for the component at the given index, 0 for x up to 3 for w
+	*/
+	inline scalar_type* lane(size_type component) {
+		return alignedBase() + component * mStride;
+	}
+
+	inline const scalar_type* lane(size_type component) const {
+		return const_cast<MayaArraySoA*>(this)->lane(component);
+	}
+
+protected:
+	std::vector<scalar_type> mBuffer;
+	size_type mSize;
+	std::size_t mStride;
+	bool mHasW;
+
+	inline size_type lanes() const {
+		return mHasW ? 4 : 3;
+	}
+
+	// the buffer has room for one extra cache line so the lanes can start on an aligned address
+	scalar_type* alignedBase() {
+		if (mBuffer.empty())
+			return nullptr;
+		std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mBuffer.data());
+		std::uintptr_t aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+		return mBuffer.data() + (aligned - address) / sizeof(scalar_type);
+	}
+
+	void commit(element_type* elements, size_type oldSize) const {
+		const scalar_type* lx = x();
+		const scalar_type* ly = y();
+		const scalar_type* lz = z();
+		for (size_type i = 0; i < mSize; ++i) {
+			scalar_type* e = &elements[i].x;
+			e[0] = lx[i];
+			e[1] = ly[i];
+			e[2] = lz[i];
+		}
+		if (components == 4) {
+			if (mHasW) {
+				const scalar_type* lw = w();
+				for (size_type i = 0; i < mSize; ++i)
+					(&elements[i].x)[3] = lw[i];
+			}
+			else {
+				for (size_type i = oldSize; i < mSize; ++i)
+					(&elements[i].x)[3] = scalar_type(1);
+			}
+		}
+	}
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_SOA_H_
@@ -0,0 +1,255 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_SORT_H_
+#define MAYAARRAY_MAYA_ARRAY_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <maya/MIntArray.h>
+#include <maya_array/maya_array.h>
+
+// arrays with fewer elements than this are sorted with std::sort, it can be
+// defined before including this header to change it
+#ifndef MAYAARRAY_RADIX_SORT_THRESHOLD
+#define MAYAARRAY_RADIX_SORT_THRESHOLD 256
+#endif
+
+namespace mayaarray {
+
+namespace detail {
+
+// maps an integer to an unsigned key with the same order, by flipping the sign bit of signed types
+template<typename V>
+inline typename std::make_unsigned<V>::type radixKey(V value) {
+	typedef typename std::make_unsigned<V>::type key_type;
+	const key_type signBit = std::is_signed<V>::value ? key_type(key_type(1) << (sizeof(V) * 8 - 1)) : key_type(0);
+	return static_cast<key_type>(value) ^ signBit;
+}
+
+// a key and the index of the element it came from, for argsort
+template<typename K>
+struct RadixKeyIndex {
+	K key;
+	int index;
+};
+
+template<typename V>
+struct RadixValueKey {
+	typename std::make_unsigned<V>::type operator()(V value) const {
+		return radixKey(value);
+	}
+};
+
+template<typename K>
+struct RadixPairKey {
+	K operator()(const RadixKeyIndex<K>& item) const {
+		return item.key;
+	}
+};
+
+/*
+Stable LSD radix sort on 8 bit digits. The histograms of all digits are counted
+in one pass, and digits that are the same for every item skip their pass, so
+small values such as component indices of a mesh are sorted in 2 or 3 passes.
+The items must be plain data and "scratch" must have room for "count" items.
+*/
+template<typename Item, typename KeyOf>
+void radixSort(Item* items, std::size_t count, Item* scratch, KeyOf keyOf) {
+	typedef decltype(keyOf(*items)) key_type;
+	const unsigned int digits = sizeof(key_type);
+	std::size_t counts[sizeof(key_type)][256];
+	std::memset(counts, 0, sizeof(counts));
+	for (std::size_t i = 0; i < count; ++i) {
+		key_type key = keyOf(items[i]);
+		for (unsigned int d = 0; d < digits; ++d)
+			++counts[d][(key >> (d * 8)) & 0xff];
+	}
+
+	Item* from = items;
+	Item* to = scratch;
+	const key_type firstKey = keyOf(items[0]);
+	for (unsigned int d = 0; d < digits; ++d) {
+		std::size_t* digitCounts = counts[d];
+		if (digitCounts[(firstKey >> (d * 8)) & 0xff] == count)
+			continue;
+		std::size_t offset = 0;
+		for (unsigned int b = 0; b < 256; ++b) {
+			std::size_t n = digitCounts[b];
+			digitCounts[b] = offset;
+			offset += n;
+		}
+		for (std::size_t i = 0; i < count; ++i)
+			to[digitCounts[(keyOf(from[i]) >> (d * 8)) & 0xff]++] = from[i];
+		std::swap(from, to);
+	}
+	if (from != items)
+		std::memcpy(static_cast<void*>(items), from, count * sizeof(Item));
+}
+
+template<typename Range>
+struct range_value {
+	typedef typename std::remove_cv<typename std::remove_reference<decltype(*std::declval<Range&>().data())>::type>::type type;
+};
+
+} // namespace detail
+
+/**
+Sorts a contiguous range of integers in ascending order with a radix sort, such
+as a MayaArray<MIntArray>, MayaArray<MUintArray>, MayaArray<MInt64Array>,
+MayaArrayRange or MayaSpan. Ranges smaller than MAYAARRAY_RADIX_SORT_THRESHOLD
+are sorted with std::sort.
+
+USAGE:
+	mayaarray::MayaArray<MIntArray> vertexIds;
+	mayaarray::radix_sort(vertexIds);
+
+\param[in,out] range the range to sort
+*/
+template<typename Range>
+void radix_sort(Range&& range) {
+	typedef typename detail::range_value<Range>::type value_type;
+	static_assert(std::is_integral<value_type>::value, "radix_sort only supports integer arrays");
+	value_type* values = range.data();
+	const std::size_t count = range.size();
+	if (count < MAYAARRAY_RADIX_SORT_THRESHOLD) {
+		std::sort(values, values + count);
+		return;
+	}
+	std::vector<value_type> scratch(count);
+	detail::radixSort(values, count, scratch.data(), detail::RadixValueKey<value_type>());
+}
+
+/**
+Returns the order that sorts the range, as the indices of the elements in
+sorted order. Elements with the same value keep their original order. The
+order can be used with "permute" to sort other arrays of the same components
+the same way.
+
+USAGE:
+	mayaarray::MayaArray<MIntArray> order = mayaarray::argsort(faceIds);
+	mayaarray::permute(faceNormals, order, sortedNormals);
+
+\param[in] range a contiguous range of integers
+
+\return
+the indices of the elements in sorted order
+*/
+template<typename Range>
+MayaArray<MIntArray> argsort(const Range& range) {
+	typedef typename detail::range_value<const Range>::type value_type;
+	typedef typename std::make_unsigned<value_type>::type key_type;
+	static_assert(std::is_integral<value_type>::value, "argsort only supports integer arrays");
+	const value_type* values = range.data();
+	const unsigned int count = static_cast<unsigned int>(range.size());
+	MayaArray<MIntArray> order(count);
+	if (!count)
+		return order;
+
+	std::vector<detail::RadixKeyIndex<key_type> > items(count * 2);
+	for (unsigned int i = 0; i < count; ++i) {
+		items[i].key = detail::radixKey(values[i]);
+		items[i].index = static_cast<int>(i);
+	}
+	if (count < MAYAARRAY_RADIX_SORT_THRESHOLD) {
+		std::stable_sort(items.begin(), items.begin() + count,
+			[](const detail::RadixKeyIndex<key_type>& a, const detail::RadixKeyIndex<key_type>& b) { return a.key < b.key; });
+	}
+	else {
+		detail::radixSort(items.data(), count, items.data() + count, detail::RadixPairKey<key_type>());
+	}
+	int* indices = order.data();
+	for (unsigned int i = 0; i < count; ++i)
+		indices[i] = items[i].index;
+	return order;
+}
+
+/**
+Writes the elements of the source range to the destination in the given
+order, so that destination[i] is source[order[i]]. This works for any array
+type, such as reordering points by the order of their ids.
+
+\param[in] source the range to read from
+\param[in] order indices into the source, such as returned by "argsort"
+\param[out] destination the array to write to, it is resized to the size of the order
+*/
+template<typename Range, typename OrderRange, typename T, typename P>
+void permute(const Range& source, const OrderRange& order, MayaArray<T, P>& destination) {
+	const unsigned int count = static_cast<unsigned int>(order.size());
+	destination.resize(count);
+	auto first = source.begin();
+	auto index = order.begin();
+	for (unsigned int i = 0; i < count; ++i, ++index)
+		destination[i] = first[*index];
+}
+
+/**
+Sorts the integers of the array and removes duplicates, shrinking the array
+with a single "setLength" call.
+
+USAGE:
+	// all vertices used by a set of faces, sorted and without duplicates
+	mayaarray::MayaArray<MIntArray> vertexIds(faceVertices);
+	mayaarray::sort_unique(vertexIds);
+
+\param[in,out] array the array to sort
+
+\return
+the number of unique elements
+*/
+template<typename T, typename P>
+typename MayaArray<T, P>::size_type sort_unique(MayaArray<T, P>& array) {
+	radix_sort(array);
+	typename MayaArray<T, P>::value_type* first = array.data();
+	typename MayaArray<T, P>::size_type count = static_cast<typename MayaArray<T, P>::size_type>(
+		std::unique(first, first + array.size()) - first);
+	array.resize(count);
+	return count;
+}
+
+/**
+Sorts the integers of a Maya array and removes duplicates, shrinking the array
+with a single "setLength" call.
+
+\param[in,out] maya_array the Maya array to sort, such as a MIntArray
+
+\return
+the number of unique elements
+*/
+template<typename T>
+typename std::enable_if<mayatemplates::is_contiguous_array<T>::value, unsigned int>::type sort_unique(T& maya_array) {
+	mayaiteration::MayaArrayRange<T> range(maya_array);
+	radix_sort(range);
+	auto* first = range.data();
+	unsigned int count = static_cast<unsigned int>(std::unique(first, first + range.size()) - first);
+	maya_array.setLength(count);
+	return count;
+}
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_SORT_H_
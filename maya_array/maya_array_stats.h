@@ -0,0 +1,419 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_ARRAY_STATS_H_
+#define MAYAARRAY_MAYA_ARRAY_STATS_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <maya/MApiNamespace.h>
+
+// MayaArray counts its operations when this is defined as 1. It must have the
+// same value in every file of a plugin. When it is 0 the counting compiles to
+// nothing and the functions below return empty results.
+#ifndef MAYAARRAY_INSTRUMENTATION
+#define MAYAARRAY_INSTRUMENTATION 0
+#endif
+
+#if MAYAARRAY_INSTRUMENTATION
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#endif
+
+namespace mayaarray {
+
+/*
+The operations of MayaArray that are counted
+
+kCountConstructions: arrays created by any constructor
+kCountCopies: copies of a whole array, by copy construction or assignment or from a raw pointer
+kCountBytesCopied: bytes copied by those copies
+kCountReallocations: times the array had to grow its memory, from appending, inserting, "reserve" or "resize"
+kCountShifts: inserts and erases that move the elements after them
+kCountElementsShifted: number of elements moved by those inserts and erases
+kCountDerefs: elements accessed through "[]", "at" and iterators, except the plain pointer iterators of contiguous arrays
+*/
+enum MayaArrayCounter {
+	kCountConstructions,
+	kCountCopies,
+	kCountBytesCopied,
+	kCountReallocations,
+	kCountShifts,
+	kCountElementsShifted,
+	kCountDerefs,
+	kCounterCount
+};
+
+/*
+Values of all counters for one array type and tag
+*/
+struct MayaArrayCounters {
+	uint64_t values[kCounterCount];
+
+	MayaArrayCounters() {
+		for (unsigned int i = 0; i < kCounterCount; ++i)
+			values[i] = 0;
+	}
+
+	uint64_t operator[](MayaArrayCounter counter) const {
+		return values[counter];
+	}
+
+	MayaArrayCounters& operator+=(const MayaArrayCounters& other) {
+		for (unsigned int i = 0; i < kCounterCount; ++i)
+			values[i] += other.values[i];
+		return *this;
+	}
+
+	// name of the counter used in the JSON output
+	static const char* name(MayaArrayCounter counter) {
+		static const char* const names[kCounterCount] = {
+			"constructions", "copies", "bytesCopied", "reallocations", "shifts", "elementsShifted", "derefs"
+		};
+		return names[counter];
+	}
+};
+
+/*
+The counters of one Maya array type for one tag
+*/
+struct MayaArrayStatsRecord {
+	std::string type;
+	std::string tag;
+	MayaArrayCounters counters;
+};
+
+namespace detail {
+
+// name of the array type in the stats, the mangled name for types not listed here
+template<typename T>
+struct stats_type_name {
+	static const char* get() {
+		return typeid(T).name();
+	}
+};
+
+#define MAYAARRAY_STATS_TYPE_NAME(T) \
+	template<> struct stats_type_name<T> { static const char* get() { return #T; } };
+
+MAYAARRAY_STATS_TYPE_NAME(MIntArray)
+MAYAARRAY_STATS_TYPE_NAME(MUintArray)
+MAYAARRAY_STATS_TYPE_NAME(MInt64Array)
+MAYAARRAY_STATS_TYPE_NAME(MFloatArray)
+MAYAARRAY_STATS_TYPE_NAME(MDoubleArray)
+MAYAARRAY_STATS_TYPE_NAME(MPointArray)
+MAYAARRAY_STATS_TYPE_NAME(MFloatPointArray)
+MAYAARRAY_STATS_TYPE_NAME(MVectorArray)
+MAYAARRAY_STATS_TYPE_NAME(MFloatVectorArray)
+MAYAARRAY_STATS_TYPE_NAME(MColorArray)
+MAYAARRAY_STATS_TYPE_NAME(MMatrixArray)
+MAYAARRAY_STATS_TYPE_NAME(MStringArray)
+MAYAARRAY_STATS_TYPE_NAME(MPlugArray)
+MAYAARRAY_STATS_TYPE_NAME(MObjectArray)
+MAYAARRAY_STATS_TYPE_NAME(MDagPathArray)
+
+#undef MAYAARRAY_STATS_TYPE_NAME
+
+inline void appendJsonString(std::string& json, const std::string& value) {
+	json += '"';
+	for (std::size_t i = 0; i < value.size(); ++i) {
+		const unsigned char c = static_cast<unsigned char>(value[i]);
+		if (c == '"' || c == '\\') {
+			json += '\\';
+			json += static_cast<char>(c);
+		}
+		else if (c < 0x20) {
+			char escaped[8];
+			std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+			json += escaped;
+		}
+		else {
+			json += static_cast<char>(c);
+		}
+	}
+	json += '"';
+}
+
+inline void appendJsonCounters(std::string& json, const MayaArrayCounters& counters) {
+	for (unsigned int i = 0; i < kCounterCount; ++i) {
+		json += (i ? ", \"" : "\"");
+		json += MayaArrayCounters::name(static_cast<MayaArrayCounter>(i));
+		json += "\": ";
+		json += std::to_string(static_cast<unsigned long long>(counters.values[i]));
+	}
+}
+
+#if MAYAARRAY_INSTRUMENTATION
+
+struct AtomicCounters {
+	std::atomic<uint64_t> values[kCounterCount];
+
+	AtomicCounters() {
+		reset();
+	}
+
+	void reset() {
+		for (unsigned int i = 0; i < kCounterCount; ++i)
+			values[i].store(0, std::memory_order_relaxed);
+	}
+};
+
+/*
+All counters by type and tag. Counters are never removed, so the pointers to
+them that each thread keeps stay valid, and resetting sets them to zero.
+*/
+class StatsRegistry {
+public:
+	static StatsRegistry& instance() {
+		static StatsRegistry registry;
+		return registry;
+	}
+
+	AtomicCounters& find(const char* type, const char* tag) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::unique_ptr<AtomicCounters>& counters = mCounters[std::make_pair(std::string(type), std::string(tag))];
+		if (!counters)
+			counters.reset(new AtomicCounters());
+		return *counters;
+	}
+
+	std::vector<MayaArrayStatsRecord> records() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::vector<MayaArrayStatsRecord> result;
+		result.reserve(mCounters.size());
+		for (auto it = mCounters.begin(); it != mCounters.end(); ++it) {
+			MayaArrayStatsRecord record;
+			record.type = it->first.first;
+			record.tag = it->first.second;
+			for (unsigned int i = 0; i < kCounterCount; ++i)
+				record.counters.values[i] = it->second->values[i].load(std::memory_order_relaxed);
+			result.push_back(record);
+		}
+		return result;
+	}
+
+	void reset() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (auto it = mCounters.begin(); it != mCounters.end(); ++it)
+			it->second->reset();
+	}
+
+protected:
+	std::mutex mMutex;
+	std::map<std::pair<std::string, std::string>, std::unique_ptr<AtomicCounters>> mCounters;
+};
+
+// tag of the calling thread, set by MayaArrayStatsScope
+inline const char*& currentStatsTag() {
+	static thread_local const char* tag = "untagged";
+	return tag;
+}
+
+template<typename T>
+inline void recordStats(MayaArrayCounter counter, uint64_t amount) {
+	// each thread keeps the counters of the last tag it used for the type
+	static thread_local const char* cachedTag = nullptr;
+	static thread_local AtomicCounters* cached = nullptr;
+	const char* tag = currentStatsTag();
+	if (tag != cachedTag || !cached) {
+		cached = &StatsRegistry::instance().find(stats_type_name<T>::get(), tag);
+		cachedTag = tag;
+	}
+	cached->values[counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+#endif // MAYAARRAY_INSTRUMENTATION
+
+} // namespace detail
+
+// used by MayaArray and its iterators to count an operation on the Maya array type T
+#if MAYAARRAY_INSTRUMENTATION
+#define MAYAARRAY_COUNT(T, counter, amount) ::mayaarray::detail::recordStats<T>(::mayaarray::counter, static_cast<uint64_t>(amount))
+#else
+#define MAYAARRAY_COUNT(T, counter, amount) ((void)0)
+#endif
+
+/**
+Maya Array Stats Scope Class
+
+DESCRIPTION:
+Sets the tag that the operations of MayaArray on the calling thread are counted
+under, until the scope ends and the previous tag is restored. The tag is
+usually the name of the function or node, so the counts show which code copies
+arrays. Tags are compared by address for speed, so they should be string
+literals or otherwise outlive every use. Operations outside of any scope are
+counted under "untagged". Without MAYAARRAY_INSTRUMENTATION the scope does
+nothing.
+
+USAGE:
+	MStatus MyDeformer::deform(MDataBlock& data, MItGeometry& iter, const MMatrix& m, unsigned int multiIndex) {
+		MAYAARRAY_STATS_SCOPE("MyDeformer::deform");
+		...
+	}
+*/
+class MayaArrayStatsScope {
+public:
+	explicit MayaArrayStatsScope(const char* tag) {
+#if MAYAARRAY_INSTRUMENTATION
+		mPrevious = detail::currentStatsTag();
+		detail::currentStatsTag() = tag;
+#else
+		(void)tag;
+#endif
+	}
+
+	~MayaArrayStatsScope() {
+#if MAYAARRAY_INSTRUMENTATION
+		detail::currentStatsTag() = mPrevious;
+#endif
+	}
+
+	MayaArrayStatsScope(const MayaArrayStatsScope&) = delete;
+	MayaArrayStatsScope& operator=(const MayaArrayStatsScope&) = delete;
+
+#if MAYAARRAY_INSTRUMENTATION
+protected:
+	const char* mPrevious;
+#endif
+};
+
+#define MAYAARRAY_STATS_CONCAT_(a, b) a##b
+#define MAYAARRAY_STATS_CONCAT(a, b) MAYAARRAY_STATS_CONCAT_(a, b)
+
+// tags the rest of the enclosing block, nothing is created without MAYAARRAY_INSTRUMENTATION
+#if MAYAARRAY_INSTRUMENTATION
+#define MAYAARRAY_STATS_SCOPE(tag) ::mayaarray::MayaArrayStatsScope MAYAARRAY_STATS_CONCAT(mayaArrayStatsScope, __LINE__)(tag)
+#else
+#define MAYAARRAY_STATS_SCOPE(tag) ((void)0)
+#endif
+
+/**
+Maya Array Stats Class
+
+DESCRIPTION:
+Reads the counters collected when the plugin is built with
+MAYAARRAY_INSTRUMENTATION, by Maya array type and tag. The counters are shared
+by all threads and can be read and reset at any time.
+
+USAGE:
+	// after a profiling run
+	mayaarray::MayaArrayStats::writeJson("/tmp/array_stats.json");
+
+	for (const mayaarray::MayaArrayStatsRecord& record : mayaarray::MayaArrayStats::records()) {
+		if (record.counters[mayaarray::kCountCopies])
+			std::cout << record.tag << " copied " << record.type << std::endl;
+	}
+*/
+class MayaArrayStats {
+public:
+	/**
+	Returns true if the plugin was built with MAYAARRAY_INSTRUMENTATION
+	*/
+	static bool enabled() {
+		return MAYAARRAY_INSTRUMENTATION != 0;
+	}
+
+	/**
+	Returns the counters of every type and tag that was used, sorted by type then tag
+	*/
+	static std::vector<MayaArrayStatsRecord> records() {
+#if MAYAARRAY_INSTRUMENTATION
+		return detail::StatsRegistry::instance().records();
+#else
+		return std::vector<MayaArrayStatsRecord>();
+#endif
+	}
+
+	/**
+	Returns the sum of the counters of all types and tags
+	*/
+	static MayaArrayCounters total() {
+		MayaArrayCounters sum;
+		std::vector<MayaArrayStatsRecord> all = records();
+		for (std::size_t i = 0; i < all.size(); ++i)
+			sum += all[i].counters;
+		return sum;
+	}
+
+	/**
+	Sets all counters to zero
+	*/
+	static void reset() {
+#if MAYAARRAY_INSTRUMENTATION
+		detail::StatsRegistry::instance().reset();
+#endif
+	}
+
+	/**
+	Returns the counters as a JSON object with "enabled", a "records" array
+	with the type, tag and counters of each record, and the "total" counters
+	*/
+	static std::string json() {
+		std::vector<MayaArrayStatsRecord> all = records();
+		MayaArrayCounters sum;
+		std::string json = "{\n\t\"enabled\": ";
+		json += enabled() ? "true" : "false";
+		json += ",\n\t\"records\": [";
+		for (std::size_t i = 0; i < all.size(); ++i) {
+			json += (i ? ",\n\t\t{\"type\": " : "\n\t\t{\"type\": ");
+			detail::appendJsonString(json, all[i].type);
+			json += ", \"tag\": ";
+			detail::appendJsonString(json, all[i].tag);
+			json += ", ";
+			detail::appendJsonCounters(json, all[i].counters);
+			json += "}";
+			sum += all[i].counters;
+		}
+		json += all.empty() ? "],\n\t\"total\": {" : "\n\t],\n\t\"total\": {";
+		detail::appendJsonCounters(json, sum);
+		json += "}\n}\n";
+		return json;
+	}
+
+	/**
+	Writes the JSON of the counters to a file
+
+	\param[in] path path of the file, which is replaced if it exists
+
+	\return
+	false if the file could not be written
+	*/
+	static bool writeJson(const char* path) {
+		std::FILE* file = std::fopen(path, "w");
+		if (!file)
+			return false;
+		const std::string text = json();
+		const bool written = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+		return (std::fclose(file) == 0 && written);
+	}
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_ARRAY_STATS_H_
@@ -0,0 +1,795 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_COMPONENT_SET_H_
+#define MAYAARRAY_MAYA_COMPONENT_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <maya/MIntArray.h>
+#include <maya_array/maya_array.h>
+#include <maya_array/maya_array_sort.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace mayaarray {
+
+namespace detail {
+
+inline unsigned int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<unsigned int>(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+	// every CPU with AVX has the popcnt instruction
+	return static_cast<unsigned int>(__popcnt64(x));
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ull);
+	x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+	x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+	return static_cast<unsigned int>((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// index of the lowest set bit, "x" must not be zero
+inline unsigned int countTrailingZeros64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<unsigned int>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return static_cast<unsigned int>(index);
+#else
+	unsigned int n = 0;
+	while (!(x & 1)) {
+		x >>= 1;
+		++n;
+	}
+	return n;
+#endif
+}
+
+// number of set bits in the words, one popcount per word with four independent
+// sums so consecutive words do not wait on each other
+inline unsigned int popcountWords(const uint64_t* words, std::size_t count) {
+	unsigned int sums[4] = {0, 0, 0, 0};
+	for (std::size_t i = 0; i < count; ++i)
+		sums[i & 3] += popcount64(words[i]);
+	return sums[0] + sums[1] + sums[2] + sums[3];
+}
+
+} // namespace detail
+
+/**
+Maya Component Set Class
+
+DESCRIPTION:
+A set of component indices, such as the selected vertices of a mesh or the
+faces of a mask. The indices are split into chunks of 65536 and each chunk is
+stored as a sorted array of 16 bit offsets when it has few indices, or as a
+bitset when it has more than kMaxSparse, which is when the bitset is smaller.
+A bitset chunk goes back to an array only when it has fewer than kMinDense
+indices, so adding and removing indices around the threshold does not convert
+the chunk every time.
+Union, intersection and difference work on whole chunks, merging the arrays
+or combining the bitsets a word at a time, and never sort or allocate per
+index the way set operations on a MIntArray do.
+
+Sets are built from and exported to a MayaArray<MIntArray>, or any range of
+integers such as a MayaArrayRange or MayaSpan. Iterating a set visits the
+indices in ascending order, and the iterators are invalidated by any change
+to the set. Negative indices are ignored.
+
+USAGE:
+	mayaarray::MayaArray<MIntArray> selectedIds, maskedIds;
+	...
+	mayaarray::MayaComponentSet selected(selectedIds);
+	selected &= mayaarray::MayaComponentSet(maskedIds);
+
+	// every vertex that is not selected
+	mayaarray::MayaComponentSet unselected;
+	unselected.insertRange(0, vertexCount);
+	unselected -= selected;
+
+	for (int vertexId : selected)
+		weights[vertexId] = 1.0f;
+
+	mayaarray::MayaArray<MIntArray> result;
+	selected.toArray(result);
+*/
+class MayaComponentSet {
+protected:
+	static const unsigned int kChunkBits = 16;
+	static const unsigned int kChunkSize = 1u << kChunkBits;
+	static const unsigned int kChunkWords = kChunkSize / 64;
+
+	struct Chunk;
+
+public:
+	typedef int value_type;
+	typedef unsigned int size_type;
+
+	// chunks with more indices than this are stored as bitsets
+	static const size_type kMaxSparse = 4096;
+	// bitset chunks with fewer indices than this are stored as arrays again
+	static const size_type kMinDense = 3584;
+
+	class const_iterator {
+	friend class MayaComponentSet;
+
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef int value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const int* pointer;
+		typedef const int& reference;
+
+		const_iterator() : mChunk(nullptr), mLast(nullptr), mPosition(0), mValue(0) {}
+
+		reference operator*() const {
+			return mValue;
+		}
+
+		pointer operator->() const {
+			return &mValue;
+		}
+
+		const_iterator& operator++() {
+			++mPosition;
+			seek();
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator previous(*this);
+			++*this;
+			return previous;
+		}
+
+		bool operator==(const const_iterator& other) const {
+			return (mChunk == other.mChunk && mPosition == other.mPosition);
+		}
+
+		bool operator!=(const const_iterator& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		const Chunk* mChunk;
+		const Chunk* mLast;
+		// offset in a bitset chunk, or position in an array chunk
+		unsigned int mPosition;
+		int mValue;
+
+		const_iterator(const Chunk* chunk, const Chunk* last) : mChunk(chunk), mLast(last), mPosition(0), mValue(0) {
+			seek();
+		}
+
+		// moves to the first index at or after the position, going to the next chunk when there is none
+		void seek() {
+			for (; mChunk != mLast; ++mChunk, mPosition = 0) {
+				const int base = static_cast<int>(mChunk->key << kChunkBits);
+				if (!mChunk->dense()) {
+					if (mPosition < mChunk->sparse.size()) {
+						mValue = base | mChunk->sparse[mPosition];
+						return;
+					}
+					continue;
+				}
+				unsigned int word = mPosition >> 6;
+				if (kChunkWords <= word)
+					continue;
+				uint64_t bits = mChunk->bits[word] & (~uint64_t(0) << (mPosition & 63));
+				while (!bits && ++word < kChunkWords)
+					bits = mChunk->bits[word];
+				if (bits) {
+					mPosition = word * 64 + detail::countTrailingZeros64(bits);
+					mValue = base | static_cast<int>(mPosition);
+					return;
+				}
+			}
+			mPosition = 0;
+		}
+	};
+
+	typedef const_iterator iterator;
+
+	MayaComponentSet() {}
+
+	/**
+	Creates a set from a range of indices, such as a MayaArray<MIntArray>. The
+	indices do not need to be sorted or unique.
+
+	\param[in] indices the range of indices
+	*/
+	template<typename Range>
+	explicit MayaComponentSet(const Range& indices, typename std::enable_if<!std::is_integral<Range>::value>::type* = nullptr) {
+		insert(indices);
+	}
+
+	const_iterator begin() const {
+		return const_iterator(mChunks.data(), mChunks.data() + mChunks.size());
+	}
+
+	const_iterator end() const {
+		return const_iterator(mChunks.data() + mChunks.size(), mChunks.data() + mChunks.size());
+	}
+
+	/**
+	Returns the number of indices in the set
+	*/
+	size_type size() const {
+		size_type count = 0;
+		for (std::size_t i = 0; i < mChunks.size(); ++i)
+			count += mChunks[i].count;
+		return count;
+	}
+
+	bool empty() const {
+		return mChunks.empty();
+	}
+
+	void clear() {
+		mChunks.clear();
+	}
+
+	void swap(MayaComponentSet& other) {
+		mChunks.swap(other.mChunks);
+	}
+
+	/**
+	Returns true if the index is in the set
+	*/
+	bool contains(value_type index) const {
+		if (index < 0)
+			return false;
+		const Chunk* chunk = findChunk(keyOf(index));
+		return chunk && chunk->contains(lowOf(index));
+	}
+
+	/**
+	Adds an index to the set
+
+	\param[in] index the component index
+
+	\return
+	true if the index was added, false if it was in the set already
+	*/
+	bool insert(value_type index) {
+		if (index < 0)
+			return false;
+		const unsigned int key = keyOf(index);
+		std::vector<Chunk>::iterator it = lowerBound(key);
+		if (it == mChunks.end() || it->key != key) {
+			it = mChunks.insert(it, Chunk());
+			it->key = key;
+		}
+		return it->insert(lowOf(index));
+	}
+
+	/**
+	Adds a range of indices to the set, which do not need to be sorted or
+	unique. The indices are sorted once and added a chunk at a time.
+
+	\param[in] indices the range of indices, such as a MayaArray<MIntArray>
+	*/
+	template<typename Range>
+	typename std::enable_if<!std::is_integral<Range>::value>::type insert(const Range& indices) {
+		MayaArray<MIntArray> sorted;
+		sorted.assign(indices.begin(), indices.end());
+		sort_unique(sorted);
+		MayaComponentSet other;
+		other.buildSorted(sorted.data(), sorted.size());
+		if (empty())
+			swap(other);
+		else
+			*this |= other;
+	}
+
+	/**
+	Adds all indices from "first" up to but not including "last", such as all
+	vertices of a mesh
+
+	\param[in] first the first index to add
+	\param[in] last one past the last index to add
+	*/
+	void insertRange(value_type first, value_type last) {
+		first = std::max(first, 0);
+		if (last <= first)
+			return;
+		MayaComponentSet other;
+		for (unsigned int key = keyOf(first); key <= keyOf(last - 1); ++key) {
+			const unsigned int begin = (key == keyOf(first)) ? lowOf(first) : 0;
+			const unsigned int end = (key == keyOf(last - 1)) ? lowOf(last - 1) + 1 : kChunkSize;
+			Chunk chunk;
+			chunk.key = key;
+			chunk.count = end - begin;
+			if (chunk.count <= kMaxSparse) {
+				chunk.sparse.resize(chunk.count);
+				for (unsigned int i = begin; i < end; ++i)
+					chunk.sparse[i - begin] = static_cast<uint16_t>(i);
+			}
+			else {
+				chunk.bits.assign(kChunkWords, 0);
+				for (unsigned int i = begin; i < end;) {
+					// fill whole words when the range covers them
+					if ((i & 63) == 0 && i + 64 <= end) {
+						chunk.bits[i >> 6] = ~uint64_t(0);
+						i += 64;
+					}
+					else {
+						chunk.bits[i >> 6] |= uint64_t(1) << (i & 63);
+						++i;
+					}
+				}
+			}
+			other.mChunks.push_back(std::move(chunk));
+		}
+		if (empty())
+			swap(other);
+		else
+			*this |= other;
+	}
+
+	/**
+	Removes an index from the set
+
+	\param[in] index the component index
+
+	\return
+	true if the index was removed, false if it was not in the set
+	*/
+	bool erase(value_type index) {
+		if (index < 0)
+			return false;
+		std::vector<Chunk>::iterator it = lowerBound(keyOf(index));
+		if (it == mChunks.end() || it->key != keyOf(index) || !it->erase(lowOf(index)))
+			return false;
+		if (!it->count)
+			mChunks.erase(it);
+		return true;
+	}
+
+	/**
+	Writes the indices of the set to the array in ascending order. The array
+	is resized once.
+
+	\param[out] indices the array to write to
+	*/
+	template<typename P>
+	void toArray(MayaArray<MIntArray, P>& indices) const {
+		indices.resize(size());
+		int* out = indices.data();
+		for (std::size_t c = 0; c < mChunks.size(); ++c) {
+			const Chunk& chunk = mChunks[c];
+			const int base = static_cast<int>(chunk.key << kChunkBits);
+			if (!chunk.dense()) {
+				for (std::size_t i = 0; i < chunk.sparse.size(); ++i)
+					*out++ = base | chunk.sparse[i];
+				continue;
+			}
+			for (unsigned int w = 0; w < kChunkWords; ++w) {
+				for (uint64_t bits = chunk.bits[w]; bits; bits &= bits - 1)
+					*out++ = base | static_cast<int>(w * 64 + detail::countTrailingZeros64(bits));
+			}
+		}
+	}
+
+	/**
+	Adds the indices of the other set to this set
+	*/
+	MayaComponentSet& operator|=(const MayaComponentSet& other) {
+		if (this == &other)
+			return *this;
+		std::vector<Chunk> result;
+		result.reserve(mChunks.size() + other.mChunks.size());
+		std::size_t a = 0, b = 0;
+		while (a < mChunks.size() || b < other.mChunks.size()) {
+			if (b == other.mChunks.size() || (a < mChunks.size() && mChunks[a].key < other.mChunks[b].key)) {
+				result.push_back(std::move(mChunks[a++]));
+			}
+			else if (a == mChunks.size() || other.mChunks[b].key < mChunks[a].key) {
+				result.push_back(other.mChunks[b++]);
+			}
+			else {
+				result.push_back(std::move(mChunks[a++]));
+				result.back().unite(other.mChunks[b++]);
+			}
+		}
+		mChunks.swap(result);
+		return *this;
+	}
+
+	/**
+	Keeps only the indices that are also in the other set
+	*/
+	MayaComponentSet& operator&=(const MayaComponentSet& other) {
+		if (this == &other)
+			return *this;
+		std::vector<Chunk> result;
+		std::size_t a = 0, b = 0;
+		while (a < mChunks.size() && b < other.mChunks.size()) {
+			if (mChunks[a].key < other.mChunks[b].key) {
+				++a;
+			}
+			else if (other.mChunks[b].key < mChunks[a].key) {
+				++b;
+			}
+			else {
+				mChunks[a].intersect(other.mChunks[b++]);
+				if (mChunks[a].count)
+					result.push_back(std::move(mChunks[a]));
+				++a;
+			}
+		}
+		mChunks.swap(result);
+		return *this;
+	}
+
+	/**
+	Removes the indices that are in the other set
+	*/
+	MayaComponentSet& operator-=(const MayaComponentSet& other) {
+		if (this == &other) {
+			clear();
+			return *this;
+		}
+		std::vector<Chunk> result;
+		result.reserve(mChunks.size());
+		std::size_t b = 0;
+		for (std::size_t a = 0; a < mChunks.size(); ++a) {
+			while (b < other.mChunks.size() && other.mChunks[b].key < mChunks[a].key)
+				++b;
+			if (b < other.mChunks.size() && other.mChunks[b].key == mChunks[a].key)
+				mChunks[a].subtract(other.mChunks[b]);
+			if (mChunks[a].count)
+				result.push_back(std::move(mChunks[a]));
+		}
+		mChunks.swap(result);
+		return *this;
+	}
+
+	/**
+	Returns the number of indices that are in both sets, without building the
+	intersection
+	*/
+	size_type intersectionSize(const MayaComponentSet& other) const {
+		size_type count = 0;
+		std::size_t a = 0, b = 0;
+		while (a < mChunks.size() && b < other.mChunks.size()) {
+			if (mChunks[a].key < other.mChunks[b].key)
+				++a;
+			else if (other.mChunks[b].key < mChunks[a].key)
+				++b;
+			else
+				count += mChunks[a++].intersectionSize(other.mChunks[b++]);
+		}
+		return count;
+	}
+
+	bool operator==(const MayaComponentSet& other) const {
+		if (mChunks.size() != other.mChunks.size())
+			return false;
+		for (std::size_t i = 0; i < mChunks.size(); ++i) {
+			if (!mChunks[i].equals(other.mChunks[i]))
+				return false;
+		}
+		return true;
+	}
+
+	bool operator!=(const MayaComponentSet& other) const {
+		return !(*this == other);
+	}
+
+protected:
+	struct Chunk {
+		unsigned int key;
+		size_type count;
+		// sorted offsets when the chunk is sparse
+		std::vector<uint16_t> sparse;
+		// kChunkWords words when the chunk is dense
+		std::vector<uint64_t> bits;
+
+		Chunk() : key(0), count(0) {}
+
+		bool dense() const {
+			return !bits.empty();
+		}
+
+		bool testBit(unsigned int low) const {
+			return (bits[low >> 6] >> (low & 63)) & 1;
+		}
+
+		bool contains(uint16_t low) const {
+			if (dense())
+				return testBit(low);
+			return std::binary_search(sparse.begin(), sparse.end(), low);
+		}
+
+		bool insert(uint16_t low) {
+			if (dense()) {
+				uint64_t& word = bits[low >> 6];
+				const uint64_t bit = uint64_t(1) << (low & 63);
+				if (word & bit)
+					return false;
+				word |= bit;
+				++count;
+				return true;
+			}
+			std::vector<uint16_t>::iterator it = std::lower_bound(sparse.begin(), sparse.end(), low);
+			if (it != sparse.end() && *it == low)
+				return false;
+			sparse.insert(it, low);
+			++count;
+			normalize();
+			return true;
+		}
+
+		bool erase(uint16_t low) {
+			if (dense()) {
+				uint64_t& word = bits[low >> 6];
+				const uint64_t bit = uint64_t(1) << (low & 63);
+				if (!(word & bit))
+					return false;
+				word &= ~bit;
+				--count;
+				normalize();
+				return true;
+			}
+			std::vector<uint16_t>::iterator it = std::lower_bound(sparse.begin(), sparse.end(), low);
+			if (it == sparse.end() || *it != low)
+				return false;
+			sparse.erase(it);
+			--count;
+			return true;
+		}
+
+		// the representation depends on how the chunk was changed, so chunks with
+		// the same indices can differ in it
+		bool equals(const Chunk& other) const {
+			if (key != other.key || count != other.count)
+				return false;
+			if (dense() == other.dense())
+				return sparse == other.sparse && bits == other.bits;
+			const Chunk& bitset = dense() ? *this : other;
+			const Chunk& array = dense() ? other : *this;
+			for (std::size_t i = 0; i < array.sparse.size(); ++i) {
+				if (!bitset.testBit(array.sparse[i]))
+					return false;
+			}
+			return true;
+		}
+
+		void makeDense() {
+			bits.assign(kChunkWords, 0);
+			for (std::size_t i = 0; i < sparse.size(); ++i)
+				bits[sparse[i] >> 6] |= uint64_t(1) << (sparse[i] & 63);
+			std::vector<uint16_t>().swap(sparse);
+		}
+
+		void makeSparse() {
+			sparse.clear();
+			sparse.reserve(count);
+			for (unsigned int w = 0; w < kChunkWords; ++w) {
+				for (uint64_t word = bits[w]; word; word &= word - 1)
+					sparse.push_back(static_cast<uint16_t>(w * 64 + detail::countTrailingZeros64(word)));
+			}
+			std::vector<uint64_t>().swap(bits);
+		}
+
+		// picks the representation for the number of indices, a chunk with
+		// between kMinDense and kMaxSparse indices keeps the one it has
+		void normalize() {
+			if (dense() && count < kMinDense)
+				makeSparse();
+			else if (!dense() && kMaxSparse < count)
+				makeDense();
+		}
+
+		void unite(const Chunk& other) {
+			if (!dense() && !other.dense()) {
+				std::vector<uint16_t> merged;
+				merged.reserve(sparse.size() + other.sparse.size());
+				std::set_union(sparse.begin(), sparse.end(), other.sparse.begin(), other.sparse.end(), std::back_inserter(merged));
+				sparse.swap(merged);
+				count = static_cast<size_type>(sparse.size());
+				normalize();
+				return;
+			}
+			if (!dense())
+				makeDense();
+			if (other.dense()) {
+				for (unsigned int w = 0; w < kChunkWords; ++w)
+					bits[w] |= other.bits[w];
+			}
+			else {
+				for (std::size_t i = 0; i < other.sparse.size(); ++i)
+					bits[other.sparse[i] >> 6] |= uint64_t(1) << (other.sparse[i] & 63);
+			}
+			count = detail::popcountWords(bits.data(), kChunkWords);
+		}
+
+		void intersect(const Chunk& other) {
+			if (dense() && other.dense()) {
+				for (unsigned int w = 0; w < kChunkWords; ++w)
+					bits[w] &= other.bits[w];
+				count = detail::popcountWords(bits.data(), kChunkWords);
+			}
+			else if (dense()) {
+				std::vector<uint16_t> kept;
+				kept.reserve(other.sparse.size());
+				for (std::size_t i = 0; i < other.sparse.size(); ++i) {
+					if (testBit(other.sparse[i]))
+						kept.push_back(other.sparse[i]);
+				}
+				std::vector<uint64_t>().swap(bits);
+				sparse.swap(kept);
+				count = static_cast<size_type>(sparse.size());
+			}
+			else if (other.dense()) {
+				sparse.erase(std::remove_if(sparse.begin(), sparse.end(),
+					[&other](uint16_t low) { return !other.testBit(low); }), sparse.end());
+				count = static_cast<size_type>(sparse.size());
+			}
+			else {
+				// the standard set algorithms may not write over their input
+				std::vector<uint16_t> kept;
+				kept.reserve(sparse.size());
+				std::set_intersection(sparse.begin(), sparse.end(), other.sparse.begin(), other.sparse.end(), std::back_inserter(kept));
+				sparse.swap(kept);
+				count = static_cast<size_type>(sparse.size());
+			}
+			normalize();
+		}
+
+		void subtract(const Chunk& other) {
+			if (dense()) {
+				if (other.dense()) {
+					for (unsigned int w = 0; w < kChunkWords; ++w)
+						bits[w] &= ~other.bits[w];
+				}
+				else {
+					for (std::size_t i = 0; i < other.sparse.size(); ++i)
+						bits[other.sparse[i] >> 6] &= ~(uint64_t(1) << (other.sparse[i] & 63));
+				}
+				count = detail::popcountWords(bits.data(), kChunkWords);
+			}
+			else if (other.dense()) {
+				sparse.erase(std::remove_if(sparse.begin(), sparse.end(),
+					[&other](uint16_t low) { return other.testBit(low); }), sparse.end());
+				count = static_cast<size_type>(sparse.size());
+			}
+			else {
+				std::vector<uint16_t> kept;
+				kept.reserve(sparse.size());
+				std::set_difference(sparse.begin(), sparse.end(), other.sparse.begin(), other.sparse.end(), std::back_inserter(kept));
+				sparse.swap(kept);
+				count = static_cast<size_type>(sparse.size());
+			}
+			normalize();
+		}
+
+		size_type intersectionSize(const Chunk& other) const {
+			if (dense() && other.dense()) {
+				size_type n = 0;
+				for (unsigned int w = 0; w < kChunkWords; ++w)
+					n += detail::popcount64(bits[w] & other.bits[w]);
+				return n;
+			}
+			if (dense() || other.dense()) {
+				const Chunk& bitset = dense() ? *this : other;
+				const Chunk& array = dense() ? other : *this;
+				size_type n = 0;
+				for (std::size_t i = 0; i < array.sparse.size(); ++i)
+					n += bitset.testBit(array.sparse[i]) ? 1 : 0;
+				return n;
+			}
+			size_type n = 0;
+			std::vector<uint16_t>::const_iterator a = sparse.begin(), b = other.sparse.begin();
+			while (a != sparse.end() && b != other.sparse.end()) {
+				if (*a < *b)
+					++a;
+				else if (*b < *a)
+					++b;
+				else {
+					++n;
+					++a;
+					++b;
+				}
+			}
+			return n;
+		}
+	};
+
+	std::vector<Chunk> mChunks;
+
+	static unsigned int keyOf(value_type index) {
+		return static_cast<unsigned int>(index) >> kChunkBits;
+	}
+
+	static uint16_t lowOf(value_type index) {
+		return static_cast<uint16_t>(static_cast<unsigned int>(index) & (kChunkSize - 1));
+	}
+
+	std::vector<Chunk>::iterator lowerBound(unsigned int key) {
+		return std::lower_bound(mChunks.begin(), mChunks.end(), key,
+			[](const Chunk& chunk, unsigned int k) { return chunk.key < k; });
+	}
+
+	const Chunk* findChunk(unsigned int key) const {
+		std::vector<Chunk>::const_iterator it = std::lower_bound(mChunks.begin(), mChunks.end(), key,
+			[](const Chunk& chunk, unsigned int k) { return chunk.key < k; });
+		return (it != mChunks.end() && it->key == key) ? &*it : nullptr;
+	}
+
+	// builds the chunks from sorted unique indices, replacing the current ones
+	void buildSorted(const int* indices, size_type count) {
+		mChunks.clear();
+		size_type i = 0;
+		while (i < count && indices[i] < 0)
+			++i;
+		while (i < count) {
+			const unsigned int key = keyOf(indices[i]);
+			size_type last = i;
+			while (last < count && keyOf(indices[last]) == key)
+				++last;
+			Chunk chunk;
+			chunk.key = key;
+			chunk.count = last - i;
+			chunk.sparse.resize(chunk.count);
+			for (size_type j = i; j < last; ++j)
+				chunk.sparse[j - i] = lowOf(indices[j]);
+			chunk.normalize();
+			mChunks.push_back(std::move(chunk));
+			i = last;
+		}
+	}
+};
+
+inline MayaComponentSet operator|(MayaComponentSet a, const MayaComponentSet& b) {
+	a |= b;
+	return a;
+}
+
+inline MayaComponentSet operator&(MayaComponentSet a, const MayaComponentSet& b) {
+	a &= b;
+	return a;
+}
+
+inline MayaComponentSet operator-(MayaComponentSet a, const MayaComponentSet& b) {
+	a -= b;
+	return a;
+}
+
+inline void swap(MayaComponentSet& a, MayaComponentSet& b) {
+	a.swap(b);
+}
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_COMPONENT_SET_H_
@@ -0,0 +1,549 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_POINT_BVH_H_
+#define MAYAARRAY_MAYA_POINT_BVH_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <maya/MBoundingBox.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MPoint.h>
+#include <tbb/parallel_invoke.h>
+#include <maya_array/maya_array.h>
+#include <maya_iteration/maya_parallel.h>
+
+namespace mayaarray {
+
+/**
+Maya Point BVH Class
+
+DESCRIPTION:
+A bounding volume hierarchy over a set of points for closest point, k nearest
+and radius queries, such as finding the driver points of a wrap deformer or
+the neighbors of a proximity constraint. The tree is built by splitting the
+points at the median of the longest axis of their bounds, with the subtrees
+built in parallel, until there are at most kLeafSize points in a leaf. The
+points are copied in leaf order so each leaf reads contiguous memory.
+
+When the points move but their number and meaning stay the same, such as an
+animated driver mesh, "refit" copies the new positions and recomputes the
+bounds of every node from the leaves up without changing the tree. This is
+much cheaper than a new build and the queries stay exact, although they get
+slower if the points move far from where they were when the tree was built.
+
+Queries can be made one point at a time, which is safe to do from many threads
+at once, or for a whole range of query points in parallel. The indices
+returned are the positions of the points in the range the tree was built from.
+
+USAGE:
+	mayaarray::MayaPointBVH driverTree;
+	...
+	// build once when the topology changes, refit on every other evaluation
+	if (driverTree.size() == driverPoints.size())
+		driverTree.refit(driverPoints);
+	else
+		driverTree.build(driverPoints);
+
+	mayaarray::MayaArray<MIntArray> closest;
+	mayaarray::MayaArray<MDoubleArray> distances;
+	driverTree.nearestBatch(points, 4, closest, &distances);
+*/
+class MayaPointBVH {
+public:
+	typedef unsigned int size_type;
+
+	// most points in a leaf
+	static const size_type kLeafSize = 8;
+	// ranges of at least this many points build their subtrees in parallel
+	static const size_type kParallelBuildSize = 4096;
+	// number of query points each task of a batch processes
+	static const size_type kQueryGrainSize = 64;
+
+	MayaPointBVH() {}
+
+	/**
+	Builds the tree for the points
+
+	\param[in] points a random access range of points, such as a MayaArray<MPointArray>
+	*/
+	template<typename PointRange>
+	explicit MayaPointBVH(const PointRange& points) {
+		build(points);
+	}
+
+	/**
+	Builds the tree for the points, replacing the current tree. The elements of
+	the range only need "x", "y" and "z" members, so MPoint and MFloatPoint
+	ranges both work.
+
+	\param[in] points a random access range of points, such as a MayaArray<MPointArray>
+	*/
+	template<typename PointRange>
+	void build(const PointRange& points) {
+		auto first = points.begin();
+		const size_type count = static_cast<size_type>(points.end() - first);
+		clear();
+		if (!count)
+			return;
+
+		std::vector<Vec3> source(count);
+		mOrder.resize(count);
+		forEachIndex(count, [&](size_type i) {
+			source[i] = Vec3(first[i].x, first[i].y, first[i].z);
+			mOrder[i] = i;
+		});
+		// leaves have at least half of kLeafSize points, rounded up, which bounds the number of nodes
+		mNodes.resize(2 * (count / ((kLeafSize + 1) / 2)) + 1);
+		std::atomic<size_type> nodeCount(1);
+		buildNode(0, 0, count, source.data(), nodeCount);
+		mNodes.resize(nodeCount);
+
+		mPoints.resize(count);
+		forEachIndex(count, [&](size_type i) {
+			mPoints[i] = source[mOrder[i]];
+		});
+	}
+
+	/**
+	Updates the tree for new positions of the same points without changing its
+	structure. The range must have the same number of points as the range the
+	tree was built from.
+
+	\param[in] points a random access range of points in the same order as when the tree was built
+
+	\return
+	false if the number of points changed, in which case the tree must be built again
+	*/
+	template<typename PointRange>
+	bool refit(const PointRange& points) {
+		auto first = points.begin();
+		const size_type count = static_cast<size_type>(points.end() - first);
+		if (count != size())
+			return false;
+		if (!count)
+			return true;
+
+		forEachIndex(count, [&](size_type i) {
+			const auto& pnt = first[mOrder[i]];
+			mPoints[i] = Vec3(pnt.x, pnt.y, pnt.z);
+		});
+		// small trees are refit without tasks by starting below the parallel depth
+		refitNode(0, (MAYAITERATION_PARALLEL_SERIAL_THRESHOLD <= count) ? 0 : kParallelRefitDepth);
+		return true;
+	}
+
+	/**
+	Returns the number of points in the tree
+	*/
+	size_type size() const {
+		return static_cast<size_type>(mPoints.size());
+	}
+
+	bool empty() const {
+		return mPoints.empty();
+	}
+
+	void clear() {
+		mNodes.clear();
+		mPoints.clear();
+		mOrder.clear();
+	}
+
+	/**
+	Returns the bounds of all points in the tree
+	*/
+	MBoundingBox boundingBox() const {
+		if (mNodes.empty())
+			return MBoundingBox();
+		const Node& root = mNodes[0];
+		return MBoundingBox(MPoint(root.lo.x, root.lo.y, root.lo.z), MPoint(root.hi.x, root.hi.y, root.hi.z));
+	}
+
+	/**
+	Returns the index of the point closest to the query point
+
+	\param[in] point the query point
+	\param[out] distance optional distance to the closest point
+
+	\return
+	index of the closest point, or -1 if the tree is empty
+	*/
+	int closest(const MPoint& point, double* distance=nullptr) const {
+		Neighbor neighbor;
+		if (!nearest(Vec3(point.x, point.y, point.z), 1, &neighbor))
+			return -1;
+		if (distance)
+			*distance = std::sqrt(neighbor.distance);
+		return static_cast<int>(mOrder[neighbor.slot]);
+	}
+
+	/**
+	Finds the "k" points closest to the query point, in order of distance
+
+	\param[in] point the query point
+	\param[in] k number of points to find
+	\param[out] indices indices of the closest points, resized to the number found
+	\param[out] distances optional distances of the closest points
+
+	\return
+	number of points found, which is less than "k" when the tree has fewer points
+	*/
+	size_type nearest(const MPoint& point, size_type k, MayaArray<MIntArray>& indices, MayaArray<MDoubleArray>* distances=nullptr) const {
+		std::vector<Neighbor> neighbors(k);
+		const size_type found = nearest(Vec3(point.x, point.y, point.z), k, neighbors.data());
+		indices.resize(found);
+		if (distances)
+			distances->resize(found);
+		for (size_type i = 0; i < found; ++i) {
+			indices[i] = static_cast<int>(mOrder[neighbors[i].slot]);
+			if (distances)
+				(*distances)[i] = std::sqrt(neighbors[i].distance);
+		}
+		return found;
+	}
+
+	/**
+	Finds all points within the radius of the query point, in no particular order
+
+	\param[in] point the query point
+	\param[in] radius the search radius, points at exactly this distance are included
+	\param[out] indices indices of the points found
+
+	\return
+	number of points found
+	*/
+	size_type radius(const MPoint& point, double radius, MayaArray<MIntArray>& indices) const {
+		std::vector<size_type> found;
+		withinRadius(Vec3(point.x, point.y, point.z), radius * radius, found);
+		indices.resize(static_cast<size_type>(found.size()));
+		for (size_type i = 0; i < indices.size(); ++i)
+			indices[i] = static_cast<int>(mOrder[found[i]]);
+		return indices.size();
+	}
+
+	/**
+	Finds the "k" closest points of every query point in parallel. The results
+	of query "q" are at "q * k" to "q * k + k" in order of distance. When the
+	tree has fewer than "k" points the missing results have index -1 and
+	distance -1.
+
+	\param[in] queries a random access range of query points
+	\param[in] k number of points to find for each query
+	\param[out] indices indices of the closest points, resized to the number of queries times "k"
+	\param[out] distances optional distances of the closest points, resized the same way
+	*/
+	template<typename QueryRange>
+	void nearestBatch(const QueryRange& queries, size_type k, MayaArray<MIntArray>& indices, MayaArray<MDoubleArray>* distances=nullptr) const {
+		auto first = queries.begin();
+		const size_type count = static_cast<size_type>(queries.end() - first);
+		indices.resize(count * k);
+		if (distances)
+			distances->resize(count * k);
+		int* outIndices = indices.data();
+		double* outDistances = distances ? distances->data() : nullptr;
+		auto task = [&](size_type begin, size_type end) {
+			std::vector<Neighbor> neighbors(k);
+			for (size_type q = begin; q != end; ++q) {
+				const auto& pnt = first[q];
+				const size_type found = nearest(Vec3(pnt.x, pnt.y, pnt.z), k, neighbors.data());
+				for (size_type i = 0; i < k; ++i) {
+					outIndices[q * k + i] = (i < found) ? static_cast<int>(mOrder[neighbors[i].slot]) : -1;
+					if (outDistances)
+						outDistances[q * k + i] = (i < found) ? std::sqrt(neighbors[i].distance) : -1.0;
+				}
+			}
+		};
+		forEachQuery(count, task);
+	}
+
+	/**
+	Finds all points within the radius of every query point in parallel. The
+	results are stored one query after another, with the points of query "q"
+	from "offsets[q]" up to "offsets[q + 1]" in no particular order.
+
+	\param[in] queries a random access range of query points
+	\param[in] radius the search radius, points at exactly this distance are included
+	\param[out] offsets start of the results of each query, resized to the number of queries plus one
+	\param[out] indices indices of the points found for all queries
+	*/
+	template<typename QueryRange>
+	void radiusBatch(const QueryRange& queries, double radius, MayaArray<MIntArray>& offsets, MayaArray<MIntArray>& indices) const {
+		auto first = queries.begin();
+		const size_type count = static_cast<size_type>(queries.end() - first);
+		offsets.resize(count + 1);
+		offsets[0] = 0;
+		int* counts = offsets.data() + 1;
+		const double radius2 = radius * radius;
+
+		// each task keeps its results until the offsets of all queries are known
+		const size_type taskCount = (count + kQueryGrainSize - 1) / kQueryGrainSize;
+		std::vector<std::vector<size_type>> results(taskCount);
+		auto task = [&](size_type begin, size_type end) {
+			std::vector<size_type>& found = results[begin / kQueryGrainSize];
+			for (size_type q = begin; q != end; ++q) {
+				const auto& pnt = first[q];
+				const std::size_t previous = found.size();
+				withinRadius(Vec3(pnt.x, pnt.y, pnt.z), radius2, found);
+				counts[q] = static_cast<int>(found.size() - previous);
+			}
+		};
+		forEachQuery(count, task);
+
+		for (size_type q = 0; q < count; ++q)
+			offsets[q + 1] += offsets[q];
+		indices.resize(static_cast<size_type>(offsets[count]));
+		int* outIndices = indices.data();
+		auto copy = [&](size_type start, size_type) {
+			const std::vector<size_type>& found = results[start / kQueryGrainSize];
+			int* out = outIndices + offsets[start];
+			for (std::size_t i = 0; i < found.size(); ++i)
+				out[i] = static_cast<int>(mOrder[found[i]]);
+		};
+		forEachQuery(count, copy);
+	}
+
+protected:
+	// subtrees above this depth are refit in parallel
+	static const size_type kParallelRefitDepth = 8;
+
+	struct Vec3 {
+		double x, y, z;
+
+		Vec3() : x(0.0), y(0.0), z(0.0) {}
+		Vec3(double x, double y, double z) : x(x), y(y), z(z) {}
+
+		double operator[](unsigned int axis) const {
+			return (axis == 0) ? x : ((axis == 1) ? y : z);
+		}
+	};
+
+	struct Node {
+		Vec3 lo;
+		Vec3 hi;
+		// first child of an inner node, the second is right after it, or first point of a leaf
+		size_type first;
+		// number of points of a leaf, 0 for an inner node
+		size_type count;
+	};
+
+	// a point found by a nearest query, with its position in leaf order and squared distance
+	struct Neighbor {
+		double distance;
+		size_type slot;
+
+		bool operator<(const Neighbor& other) const {
+			return distance < other.distance;
+		}
+	};
+
+	struct StackEntry {
+		size_type node;
+		double distance;
+	};
+
+	std::vector<Node> mNodes;
+	// points in leaf order
+	std::vector<Vec3> mPoints;
+	// index of each point in leaf order in the range the tree was built from
+	std::vector<size_type> mOrder;
+
+	static double distance2(const Vec3& a, const Vec3& b) {
+		const double dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	// squared distance from the point to the bounds of the node, 0 when it is inside
+	static double boxDistance2(const Node& node, const Vec3& p) {
+		const double dx = std::max(std::max(node.lo.x - p.x, p.x - node.hi.x), 0.0);
+		const double dy = std::max(std::max(node.lo.y - p.y, p.y - node.hi.y), 0.0);
+		const double dz = std::max(std::max(node.lo.z - p.z, p.z - node.hi.z), 0.0);
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	static void expand(Node& node, const Vec3& p) {
+		node.lo = Vec3(std::min(node.lo.x, p.x), std::min(node.lo.y, p.y), std::min(node.lo.z, p.z));
+		node.hi = Vec3(std::max(node.hi.x, p.x), std::max(node.hi.y, p.y), std::max(node.hi.z, p.z));
+	}
+
+	static void merge(Node& node, const Node& a, const Node& b) {
+		node.lo = Vec3(std::min(a.lo.x, b.lo.x), std::min(a.lo.y, b.lo.y), std::min(a.lo.z, b.lo.z));
+		node.hi = Vec3(std::max(a.hi.x, b.hi.x), std::max(a.hi.y, b.hi.y), std::max(a.hi.z, b.hi.z));
+	}
+
+	void buildNode(size_type index, size_type begin, size_type end, const Vec3* source, std::atomic<size_type>& nodeCount) {
+		Node& node = mNodes[index];
+		node.lo = node.hi = source[mOrder[begin]];
+		for (size_type i = begin + 1; i < end; ++i)
+			expand(node, source[mOrder[i]]);
+		if (end - begin <= kLeafSize) {
+			node.first = begin;
+			node.count = end - begin;
+			return;
+		}
+
+		const Vec3 extent(node.hi.x - node.lo.x, node.hi.y - node.lo.y, node.hi.z - node.lo.z);
+		const unsigned int axis = (extent.x < extent.y) ? ((extent.y < extent.z) ? 2 : 1) : ((extent.x < extent.z) ? 2 : 0);
+		const size_type middle = begin + (end - begin) / 2;
+		std::nth_element(mOrder.begin() + begin, mOrder.begin() + middle, mOrder.begin() + end,
+			[source, axis](size_type a, size_type b) { return source[a][axis] < source[b][axis]; });
+
+		const size_type children = nodeCount.fetch_add(2);
+		node.first = children;
+		node.count = 0;
+		if (kParallelBuildSize <= end - begin) {
+			tbb::parallel_invoke(
+				[&] { buildNode(children, begin, middle, source, nodeCount); },
+				[&] { buildNode(children + 1, middle, end, source, nodeCount); });
+		}
+		else {
+			buildNode(children, begin, middle, source, nodeCount);
+			buildNode(children + 1, middle, end, source, nodeCount);
+		}
+	}
+
+	void refitNode(size_type index, size_type depth) {
+		Node& node = mNodes[index];
+		if (node.count) {
+			node.lo = node.hi = mPoints[node.first];
+			for (size_type i = node.first + 1; i < node.first + node.count; ++i)
+				expand(node, mPoints[i]);
+			return;
+		}
+		if (depth < kParallelRefitDepth) {
+			tbb::parallel_invoke(
+				[&] { refitNode(node.first, depth + 1); },
+				[&] { refitNode(node.first + 1, depth + 1); });
+		}
+		else {
+			refitNode(node.first, depth + 1);
+			refitNode(node.first + 1, depth + 1);
+		}
+		merge(node, mNodes[node.first], mNodes[node.first + 1]);
+	}
+
+	// finds the k nearest points in order of distance, "neighbors" must have room for k
+	size_type nearest(const Vec3& p, size_type k, Neighbor* neighbors) const {
+		if (mNodes.empty() || !k)
+			return 0;
+		size_type found = 0;
+		// the tree is balanced, so its depth is about log2 of the number of leaves
+		StackEntry stack[64];
+		size_type top = 0;
+		stack[top++] = StackEntry{0, boxDistance2(mNodes[0], p)};
+		while (top) {
+			const StackEntry entry = stack[--top];
+			// neighbors is a max heap on distance once it is full
+			if (found == k && neighbors[0].distance <= entry.distance)
+				continue;
+			const Node& node = mNodes[entry.node];
+			if (node.count) {
+				for (size_type i = node.first; i < node.first + node.count; ++i) {
+					const double d = distance2(mPoints[i], p);
+					if (found < k) {
+						neighbors[found++] = Neighbor{d, i};
+						if (found == k)
+							std::make_heap(neighbors, neighbors + k);
+					}
+					else if (d < neighbors[0].distance) {
+						std::pop_heap(neighbors, neighbors + k);
+						neighbors[k - 1] = Neighbor{d, i};
+						std::push_heap(neighbors, neighbors + k);
+					}
+				}
+				continue;
+			}
+			// visit the nearer child first by pushing it last
+			StackEntry left{node.first, boxDistance2(mNodes[node.first], p)};
+			StackEntry right{node.first + 1, boxDistance2(mNodes[node.first + 1], p)};
+			if (left.distance < right.distance)
+				std::swap(left, right);
+			stack[top++] = left;
+			stack[top++] = right;
+		}
+		std::sort(neighbors, neighbors + found);
+		return found;
+	}
+
+	// appends the leaf order positions of all points within the squared radius
+	void withinRadius(const Vec3& p, double radius2, std::vector<size_type>& found) const {
+		if (mNodes.empty())
+			return;
+		size_type stack[64];
+		size_type top = 0;
+		stack[top++] = 0;
+		while (top) {
+			const Node& node = mNodes[stack[--top]];
+			if (radius2 < boxDistance2(node, p))
+				continue;
+			if (node.count) {
+				for (size_type i = node.first; i < node.first + node.count; ++i) {
+					if (distance2(mPoints[i], p) <= radius2)
+						found.push_back(i);
+				}
+				continue;
+			}
+			stack[top++] = node.first;
+			stack[top++] = node.first + 1;
+		}
+	}
+
+	// calls the function with every index, in parallel for large counts
+	template<typename Func>
+	static void forEachIndex(size_type count, Func func) {
+		if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD) {
+			for (size_type i = 0; i < count; ++i)
+				func(i);
+			return;
+		}
+		tbb::parallel_for(tbb::blocked_range<size_type>(0, count, mayaiteration::kDefaultGrainSize),
+			[&](const tbb::blocked_range<size_type>& chunk) {
+				for (size_type i = chunk.begin(); i != chunk.end(); ++i)
+					func(i);
+			});
+	}
+
+	// calls the task with ranges of kQueryGrainSize queries that start at multiples of it
+	template<typename Task>
+	static void forEachQuery(size_type count, Task& task) {
+		if (count <= kQueryGrainSize) {
+			if (count)
+				task(0, count);
+			return;
+		}
+		tbb::parallel_for(tbb::blocked_range<size_type>(0, (count + kQueryGrainSize - 1) / kQueryGrainSize),
+			[&](const tbb::blocked_range<size_type>& chunk) {
+				for (size_type t = chunk.begin(); t != chunk.end(); ++t)
+					task(t * kQueryGrainSize, std::min((t + 1) * kQueryGrainSize, count));
+			});
+	}
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_POINT_BVH_H_
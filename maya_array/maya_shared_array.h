@@ -0,0 +1,407 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_SHARED_ARRAY_H_
+#define MAYAARRAY_MAYA_SHARED_ARRAY_H_
+
+#include <atomic>
+#include <utility>
+#include <maya_array/maya_array.h>
+
+namespace mayaarray {
+
+/**
+Maya Shared Array Class Template
+
+DESCRIPTION:
+A MayaArray with shared, reference counted storage that is copied only when
+it is about to be changed. Copying a MayaSharedArray only increments a count,
+so evaluation caches, undo entries and worker threads can all hold the same
+frame's points for the cost of one array. The first mutable access through a
+copy whose storage is shared makes a private copy of the elements, which is
+called detaching. After that the copy is changed on its own.
+
+The const functions never detach. The non-const "begin", "end", "[]", "at",
+"data", "array" and "values" detach, because they hand out references that
+may be written through, even if they are only read. To read a non-const
+instance use "cbegin", "cend", "cref" or a const reference to it.
+
+A reference or iterator from a mutable accessor would still write to the
+storage after the instance is copied, changing the copy as well. So once one
+has been handed out, the storage is unshareable and the next copy of the
+instance copies the elements, the same as Qt's containers. Call
+"make_shareable" when those references are no longer used to make copies
+cheap again.
+
+The count is atomic, so different instances that share storage can be read,
+copied, destroyed and detached from any thread at the same time. A single
+instance is not safe to change from one thread while it is used by another,
+the same as std::shared_ptr. Iterators and references into the storage are
+invalidated when the instance detaches.
+
+USAGE:
+	mayaarray::MayaArray<MPointArray> points;
+	iter.allPositions(points.array());
+
+	// take over the points without copying
+	mayaarray::MayaSharedArray<MPointArray> frame(std::move(points));
+
+	// these do not copy the elements
+	cache.store(time, frame);
+	undoEntry.points = frame;
+
+	// copies the elements once, the cache and undo entry keep the original
+	mayaarray::MayaSharedArray<MPointArray> edited(frame);
+	edited[0] = MPoint::origin;
+
+	// "edited" handed out a reference, so storing it would copy the elements
+	// unless it is made shareable again first
+	edited.make_shareable();
+	cache.store(time + 1.0, edited);
+*/
+template<typename T, typename Policy=mayaiteration::default_iterator_policy>
+class MayaSharedArray {
+public:
+	typedef MayaArray<T, Policy> array_type;
+	typedef typename array_type::reference reference;
+	typedef typename array_type::const_reference const_reference;
+	typedef typename array_type::value_type value_type;
+	typedef typename array_type::size_type size_type;
+	typedef typename array_type::iterator iterator;
+	typedef typename array_type::const_iterator const_iterator;
+
+	/**
+	Creates an empty array, no storage is allocated until it is changed
+	*/
+	MayaSharedArray() : mStorage(nullptr) {}
+
+	/**
+	Creates an array with a copy of the values of the given array
+
+	\param[in] values the array to copy
+	*/
+	explicit MayaSharedArray(const array_type& values) : mStorage(new Storage(values)) {}
+
+	/**
+	Creates an array that takes over the contents of the given array
+
+	\param[in] values the array to take the contents of
+	*/
+	explicit MayaSharedArray(array_type&& values) : mStorage(new Storage(std::move(values))) {}
+
+	/**
+	Creates an array with a copy of the given M***Array instance
+
+	\param[in] maya_array the Maya array to copy
+	*/
+	explicit MayaSharedArray(const T& maya_array) : mStorage(new Storage(array_type(maya_array))) {}
+
+	/**
+	Creates an array that takes over the contents of the given M***Array instance
+
+	\param[in] maya_array the Maya array to take the contents of
+	*/
+	explicit MayaSharedArray(T&& maya_array) : mStorage(new Storage(array_type(std::move(maya_array)))) {}
+
+	/**
+	Creates an array that shares the storage of another, without copying the
+	elements unless the other array handed out mutable references
+
+	\param[in] other the array to share
+	*/
+	MayaSharedArray(const MayaSharedArray& other)
+		: mStorage(other.mStorage && !other.mStorage->shareable ? new Storage(other.mStorage->array) : other.mStorage) {
+		if (mStorage == other.mStorage)
+			retain();
+	}
+
+	/**
+	Creates an array that takes over the storage of another, leaving it empty
+
+	\param[in] other the array to take over
+	*/
+	MayaSharedArray(MayaSharedArray&& other) noexcept : mStorage(other.mStorage) {
+		other.mStorage = nullptr;
+	}
+
+	~MayaSharedArray() {
+		releaseStorage();
+	}
+
+	/**
+	Shares the storage of another array, without copying the elements unless
+	the other array handed out mutable references
+
+	\param[in] other the array to share
+	*/
+	MayaSharedArray& operator=(const MayaSharedArray& other) {
+		if (mStorage != other.mStorage) {
+			MayaSharedArray(other).swap(*this);
+		}
+		return *this;
+	}
+
+	/**
+	Takes over the storage of another array, leaving it empty
+
+	\param[in] other the array to take over
+	*/
+	MayaSharedArray& operator=(MayaSharedArray&& other) noexcept {
+		if (this != &other) {
+			releaseStorage();
+			mStorage = other.mStorage;
+			other.mStorage = nullptr;
+		}
+		return *this;
+	}
+
+	void swap(MayaSharedArray& other) noexcept {
+		std::swap(mStorage, other.mStorage);
+	}
+
+	/**
+	Returns the number of instances sharing the storage, 0 if no storage is allocated
+
+	\return
+	number of instances
+	*/
+	unsigned int use_count() const {
+		return mStorage ? mStorage->refs.load(std::memory_order_acquire) : 0;
+	}
+
+	/**
+	Returns true if this is the only instance using the storage, so changing it
+	will not copy
+
+	\return
+	true if not shared
+	*/
+	inline bool unique() const {
+		return use_count() <= 1;
+	}
+
+	/**
+	Returns true if both arrays use the same storage
+
+	\param[in] other the other array
+
+	\return
+	true if shared
+	*/
+	inline bool shares(const MayaSharedArray& other) const {
+		return mStorage != nullptr && mStorage == other.mStorage;
+	}
+
+	/**
+	Returns the values for reading, this never copies
+
+	\return
+	the values
+	*/
+	inline const array_type& values() const {
+		return mStorage ? mStorage->array : emptyArray();
+	}
+
+	/**
+	Returns the values for changing, copying them first if they are shared.
+	The storage is unshareable afterwards, see "make_shareable".
+
+	\return
+	the values
+	*/
+	inline array_type& values() {
+		detach();
+		mStorage->shareable = false;
+		return mStorage->array;
+	}
+
+	inline const T& array() const {
+		return values().array();
+	}
+
+	inline T& array() {
+		return values().array();
+	}
+
+	inline const value_type* data() const {
+		return values().data();
+	}
+
+	inline value_type* data() {
+		return values().data();
+	}
+
+	inline const_iterator begin() const {
+		return values().begin();
+	}
+
+	inline const_iterator end() const {
+		return values().end();
+	}
+
+	inline const_iterator cbegin() const {
+		return values().cbegin();
+	}
+
+	inline const_iterator cend() const {
+		return values().cend();
+	}
+
+	inline iterator begin() {
+		return values().begin();
+	}
+
+	inline iterator end() {
+		return values().end();
+	}
+
+	inline const_reference operator[](size_type pos) const {
+		return values()[pos];
+	}
+
+	inline reference operator[](size_type pos) {
+		return values()[pos];
+	}
+
+	/**
+	Returns a const reference to the value at the position without detaching,
+	for reading from a non-const array
+
+	\param[in] pos position in the array
+
+	\return
+	const reference to the value
+	*/
+	inline const_reference cref(size_type pos) const {
+		return values()[pos];
+	}
+
+	inline const_reference at(size_type pos) const {
+		return values().at(pos);
+	}
+
+	inline reference at(size_type pos) {
+		return values().at(pos);
+	}
+
+	inline size_type size() const {
+		return mStorage ? mStorage->array.size() : 0;
+	}
+
+	inline bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	Makes this array the only user of its storage, copying the elements if
+	they are shared. The mutable accessors call this, so it is only needed to
+	copy ahead of time, such as before handing the array to another thread.
+	*/
+	void detach() {
+		if (!mStorage) {
+			mStorage = new Storage(array_type());
+		}
+		else if (mStorage->refs.load(std::memory_order_acquire) != 1) {
+			Storage* copy = new Storage(mStorage->array);
+			releaseStorage();
+			mStorage = copy;
+		}
+	}
+
+	/**
+	Lets copies share the storage again after mutable references were handed
+	out. References and iterators taken before this must not be written
+	through after the array is copied.
+	*/
+	void make_shareable() {
+		if (mStorage)
+			mStorage->shareable = true;
+	}
+
+	/**
+	Releases the storage, leaving this array empty
+	*/
+	void reset() {
+		releaseStorage();
+		mStorage = nullptr;
+	}
+
+	/**
+	Returns the values and leaves this array empty. The values are moved out
+	when this is the only user of the storage, otherwise they are copied.
+
+	\return
+	the values
+	*/
+	array_type release() {
+		array_type result;
+		if (mStorage) {
+			if (mStorage->refs.load(std::memory_order_acquire) == 1)
+				result = std::move(mStorage->array);
+			else
+				result = mStorage->array;
+			reset();
+		}
+		return result;
+	}
+
+protected:
+	struct Storage {
+		explicit Storage(const array_type& values) : refs(1), shareable(true), array(values) {}
+		explicit Storage(array_type&& values) : refs(1), shareable(true), array(std::move(values)) {}
+
+		std::atomic<unsigned int> refs;
+		// false once a mutable reference was handed out, only changed while
+		// a single instance uses the storage
+		bool shareable;
+		array_type array;
+	};
+
+	static const array_type& emptyArray() {
+		static const array_type empty;
+		return empty;
+	}
+
+	void retain() {
+		if (mStorage)
+			mStorage->refs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// the last instance to let go deletes the storage, the acquire and release
+	// make all changes from other threads visible before it is deleted
+	void releaseStorage() {
+		if (mStorage && mStorage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete mStorage;
+	}
+
+	Storage* mStorage;
+};
+
+template<typename T, typename P>
+inline void swap(MayaSharedArray<T, P>& a, MayaSharedArray<T, P>& b) noexcept {
+	a.swap(b);
+}
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_SHARED_ARRAY_H_
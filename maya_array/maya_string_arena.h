@@ -0,0 +1,681 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_STRING_ARENA_H_
+#define MAYAARRAY_MAYA_STRING_ARENA_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <maya/MIntArray.h>
+#include <maya/MString.h>
+#include <maya/MStringArray.h>
+#include <maya/MUniqueString.h>
+#include <maya_array/maya_array.h>
+#include <maya_templates/maya_stl.h>
+
+namespace mayaarray {
+
+/**
+Maya String View Class
+
+DESCRIPTION:
+A pointer and length to characters owned by something else, such as a
+MayaStringArena or a MString. It is only valid while the owner is alive and
+unchanged. The hash is the same as mayatemplates::hashString of a MString with
+the same contents.
+
+USAGE:
+	mayaarray::MayaStringView name = arena[i];
+	if (name.startsWith("pCube"))
+		...
+*/
+class MayaStringView {
+public:
+	typedef unsigned int size_type;
+
+	MayaStringView() : mData(""), mLength(0) {}
+	MayaStringView(const char* data, size_type length) : mData(data), mLength(length) {}
+	MayaStringView(const char* data) : mData(data), mLength(static_cast<size_type>(std::strlen(data))) {}
+	MayaStringView(const MString& value) : mData(value.asChar()), mLength(value.length()) {}
+
+	inline const char* data() const {
+		return mData;
+	}
+
+	inline size_type size() const {
+		return mLength;
+	}
+
+	inline size_type length() const {
+		return mLength;
+	}
+
+	inline bool empty() const {
+		return mLength == 0;
+	}
+
+	inline const char* begin() const {
+		return mData;
+	}
+
+	inline const char* end() const {
+		return mData + mLength;
+	}
+
+	inline char operator[](size_type pos) const {
+		return mData[pos];
+	}
+
+	/**
+	Returns true if the string starts with the prefix
+
+	\param[in] prefix the characters to look for
+
+	\return
+	true if it starts with the prefix
+	*/
+	bool startsWith(MayaStringView prefix) const {
+		return prefix.mLength <= mLength && std::memcmp(mData, prefix.mData, prefix.mLength) == 0;
+	}
+
+	/**
+	Returns true if the string ends with the suffix
+
+	\param[in] suffix the characters to look for
+
+	\return
+	true if it ends with the suffix
+	*/
+	bool endsWith(MayaStringView suffix) const {
+		return suffix.mLength <= mLength && std::memcmp(mData + mLength - suffix.mLength, suffix.mData, suffix.mLength) == 0;
+	}
+
+	/**
+	Returns the position of the first matching character at or after "from"
+
+	\param[in] c the character to look for
+	\param[in] from position to start looking at
+
+	\return
+	position of the character, or -1 if it was not found
+	*/
+	int find(char c, size_type from=0) const {
+		if (mLength <= from)
+			return -1;
+		const void* found = std::memchr(mData + from, c, mLength - from);
+		return found ? static_cast<int>(static_cast<const char*>(found) - mData) : -1;
+	}
+
+	/**
+	Returns the position of the last matching character
+
+	\param[in] c the character to look for
+
+	\return
+	position of the character, or -1 if it was not found
+	*/
+	int rfind(char c) const {
+		for (size_type i = mLength; 0 < i; --i) {
+			if (mData[i - 1] == c)
+				return static_cast<int>(i - 1);
+		}
+		return -1;
+	}
+
+	/**
+	Returns a view of part of the string, "count" is clamped to the end
+
+	\param[in] pos position of the first character
+	\param[in] count number of characters
+
+	\return
+	the part of the string
+	*/
+	MayaStringView substr(size_type pos, size_type count=~0u) const {
+		assert(pos <= mLength);
+		return MayaStringView(mData + pos, count < mLength - pos ? count : mLength - pos);
+	}
+
+	/**
+	Returns a copy of the characters as a MString
+
+	\return
+	the string
+	*/
+	MString toMString() const {
+		return MString(mData, static_cast<int>(mLength));
+	}
+
+	std::size_t hash() const {
+		return mayatemplates::hashBytes(mData, mLength);
+	}
+
+	bool operator==(MayaStringView other) const {
+		return mLength == other.mLength && std::memcmp(mData, other.mData, mLength) == 0;
+	}
+
+	bool operator!=(MayaStringView other) const {
+		return !(*this == other);
+	}
+
+	bool operator<(MayaStringView other) const {
+		const int order = std::memcmp(mData, other.mData, mLength < other.mLength ? mLength : other.mLength);
+		return order < 0 || (order == 0 && mLength < other.mLength);
+	}
+
+protected:
+	const char* mData;
+	size_type mLength;
+};
+
+/**
+Maya String Arena Class
+
+DESCRIPTION:
+Stores many strings in one buffer of characters instead of one allocation per
+MString, for passes over the names or paths of a whole scene. Each string is
+followed by a null character, so "c_str" can be given to functions that take
+a const char*. Clearing the arena keeps its memory for the next pass.
+
+Views returned by the arena are invalidated when strings are added, since
+the buffer may move.
+
+USAGE:
+	MStringArray paths;
+	MGlobal::executeCommand("ls -long -type transform", paths);
+
+	mayaarray::MayaStringArena names(paths);
+	mayaarray::MayaArray<MIntArray> matches;
+	names.findPrefix("|rig|", matches);
+
+	// split a DAG path into its node names
+	mayaarray::MayaStringArena parts;
+	parts.split(names[0], '|');
+*/
+class MayaStringArena {
+public:
+	typedef unsigned int size_type;
+
+	MayaStringArena() {
+		mOffsets.push_back(0);
+	}
+
+	/**
+	Creates an arena with a copy of all strings of the array
+
+	\param[in] strings the strings to copy
+	*/
+	explicit MayaStringArena(const MStringArray& strings) {
+		mOffsets.push_back(0);
+		append(strings);
+	}
+
+	template<typename P>
+	explicit MayaStringArena(const MayaArray<MStringArray, P>& strings) {
+		mOffsets.push_back(0);
+		append(strings.array());
+	}
+
+	/**
+	Makes room for "strings" strings with "chars" characters in total
+
+	\param[in] strings number of strings
+	\param[in] chars number of characters, not counting the nulls
+	*/
+	void reserve(size_type strings, std::size_t chars) {
+		mOffsets.reserve(strings + 1);
+		mChars.reserve(chars + strings);
+	}
+
+	/**
+	Adds a copy of the string to the end of the arena. The string must not be
+	a view of a string in this arena.
+
+	\param[in] value the string to add
+	*/
+	void push_back(MayaStringView value) {
+		mChars.insert(mChars.end(), value.begin(), value.end());
+		mChars.push_back('\0');
+		mOffsets.push_back(static_cast<size_type>(mChars.size()));
+	}
+
+	/**
+	Adds copies of all strings of the array, growing the buffer only once
+
+	\param[in] strings the strings to add
+	*/
+	void append(const MStringArray& strings) {
+		const size_type count = strings.length();
+		std::size_t chars = 0;
+		for (size_type i = 0; i < count; ++i)
+			chars += strings[i].length();
+		reserve(size() + count, mChars.size() + chars);
+		for (size_type i = 0; i < count; ++i)
+			push_back(strings[i]);
+	}
+
+	/**
+	Splits the text at every separator and adds the parts to the end of the
+	arena. The text must not be a view of a string in this arena.
+
+	\param[in] text the text to split
+	\param[in] separator the character between the parts
+	\param[in] skipEmpty skip empty parts, such as before the first "|" of a full DAG path
+
+	\return
+	number of parts added
+	*/
+	size_type split(MayaStringView text, char separator, bool skipEmpty=true) {
+		const size_type oldSize = size();
+		// the parts take the same characters as the text, less the separators
+		mChars.reserve(mChars.size() + text.size() + 1);
+		size_type first = 0;
+		while (first <= text.size()) {
+			int found = text.find(separator, first);
+			size_type last = found < 0 ? text.size() : static_cast<size_type>(found);
+			if (!skipEmpty || first < last)
+				push_back(text.substr(first, last - first));
+			first = last + 1;
+		}
+		return size() - oldSize;
+	}
+
+	/**
+	Removes all strings, keeping the memory
+	*/
+	void clear() {
+		mChars.clear();
+		mOffsets.resize(1);
+	}
+
+	inline size_type size() const {
+		return static_cast<size_type>(mOffsets.size() - 1);
+	}
+
+	inline bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	Returns the number of characters of all strings, not counting the nulls
+
+	\return
+	number of characters
+	*/
+	inline std::size_t charCount() const {
+		return mChars.size() - size();
+	}
+
+	/**
+	Returns a view of the string at the position
+
+	\param[in] pos position of the string
+
+	\return
+	view of the string
+	*/
+	inline MayaStringView operator[](size_type pos) const {
+		assert(pos < size());
+		return MayaStringView(&mChars[mOffsets[pos]], mOffsets[pos + 1] - mOffsets[pos] - 1);
+	}
+
+	/**
+	Returns the null terminated string at the position
+
+	\param[in] pos position of the string
+
+	\return
+	pointer to the characters
+	*/
+	inline const char* c_str(size_type pos) const {
+		assert(pos < size());
+		return &mChars[mOffsets[pos]];
+	}
+
+	/**
+	Joins all strings with the separator between them into one MString
+
+	\param[in] separator characters between the strings
+
+	\return
+	the joined string
+	*/
+	MString join(MayaStringView separator) const {
+		if (empty())
+			return MString();
+		std::string joined;
+		joined.reserve(charCount() + (size() - 1) * separator.size());
+		for (size_type i = 0; i < size(); ++i) {
+			if (i)
+				joined.append(separator.data(), separator.size());
+			MayaStringView value = (*this)[i];
+			joined.append(value.data(), value.size());
+		}
+		return MString(joined.data(), static_cast<int>(joined.size()));
+	}
+
+	/**
+	Appends the positions of all strings that start with the prefix
+
+	\param[in] prefix the characters to look for
+	\param[out] indices the positions are appended to this array
+	*/
+	template<typename P>
+	void findPrefix(MayaStringView prefix, MayaArray<MIntArray, P>& indices) const {
+		for (size_type i = 0; i < size(); ++i) {
+			if ((*this)[i].startsWith(prefix))
+				indices.push_back(static_cast<int>(i));
+		}
+	}
+
+	/**
+	Copies all strings to a Maya string array, replacing its contents
+
+	\param[out] strings the array to copy the strings to
+	*/
+	template<typename P>
+	void toArray(MayaArray<MStringArray, P>& strings) const {
+		strings.resize(size());
+		for (size_type i = 0; i < size(); ++i) {
+			MayaStringView value = (*this)[i];
+			strings[i].set(value.data(), static_cast<int>(value.size()));
+		}
+	}
+
+protected:
+	std::vector<char> mChars;
+	// start of each string in mChars, with the end of the last string at the back
+	std::vector<size_type> mOffsets;
+};
+
+/**
+Joins all strings of the array with the separator between them, allocating
+the result only once
+
+\param[in] strings the strings to join
+\param[in] separator characters between the strings
+
+\return
+the joined string
+*/
+inline MString join(const MStringArray& strings, MayaStringView separator) {
+	const unsigned int count = strings.length();
+	if (count == 0)
+		return MString();
+	std::size_t chars = (count - 1) * static_cast<std::size_t>(separator.size());
+	for (unsigned int i = 0; i < count; ++i)
+		chars += strings[i].length();
+	std::string joined;
+	joined.reserve(chars);
+	for (unsigned int i = 0; i < count; ++i) {
+		if (i)
+			joined.append(separator.data(), separator.size());
+		joined.append(strings[i].asChar(), strings[i].length());
+	}
+	return MString(joined.data(), static_cast<int>(joined.size()));
+}
+
+template<typename P>
+inline MString join(const MayaArray<MStringArray, P>& strings, MayaStringView separator) {
+	return join(strings.array(), separator);
+}
+
+/**
+Splits the text at every separator into the array, replacing its contents.
+The array is sized once for all parts.
+
+\param[in] text the text to split
+\param[in] separator the character between the parts
+\param[out] parts the array to store the parts in
+\param[in] skipEmpty skip empty parts, such as before the first "|" of a full DAG path
+
+\return
+number of parts
+*/
+template<typename P>
+unsigned int split(MayaStringView text, char separator, MayaArray<MStringArray, P>& parts, bool skipEmpty=true) {
+	unsigned int count = 0;
+	for (int pass = 0; pass < 2; ++pass) {
+		if (pass)
+			parts.resize(count);
+		unsigned int index = 0;
+		unsigned int first = 0;
+		while (first <= text.size()) {
+			int found = text.find(separator, first);
+			unsigned int last = found < 0 ? text.size() : static_cast<unsigned int>(found);
+			if (!skipEmpty || first < last) {
+				if (pass)
+					parts[index].set(text.data() + first, static_cast<int>(last - first));
+				++index;
+			}
+			first = last + 1;
+		}
+		count = index;
+	}
+	return count;
+}
+
+/**
+Maya Interned Strings Class
+
+DESCRIPTION:
+Gives every distinct string a small integer id, so names can be compared,
+sorted and removed as duplicates by id instead of by contents. The strings
+are stored once in a MayaStringArena and looked up in a hash table without
+creating any MString.
+
+For Maya functions that take MUniqueString, "unique" interns a string with
+Maya the first time it is asked for and keeps the result. Converting an array
+of ids to MUniqueString then interns each distinct name only once, and the
+results can be compared by pointer like any MUniqueString.
+
+USAGE:
+	mayaarray::MayaInternedStrings interned;
+	mayaarray::MayaArray<MIntArray> ids;
+	interned.intern(nodeNames, ids);
+
+	// the ids of equal names are equal
+	mayaarray::sort_unique(ids);
+
+	std::vector<MUniqueString> unique;
+	interned.toUniqueStrings(ids, unique);
+*/
+class MayaInternedStrings {
+public:
+	typedef unsigned int size_type;
+
+	MayaInternedStrings() {}
+
+	/**
+	Returns the id of the string, adding it if it has not been seen before.
+	Ids start at 0 and increase by one for every new string.
+
+	\param[in] value the string to intern
+
+	\return
+	id of the string
+	*/
+	size_type intern(MayaStringView value) {
+		const std::size_t hash = value.hash();
+		if (mSlots.size() <= 2 * (size() + 1))
+			rehash(mSlots.empty() ? 64 : 2 * mSlots.size());
+		std::size_t slot = probe(value, hash);
+		if (mSlots[slot])
+			return mSlots[slot] - 1;
+		const size_type id = size();
+		mStrings.push_back(value);
+		mHashes.push_back(hash);
+		mSlots[slot] = id + 1;
+		return id;
+	}
+
+	/**
+	Interns all strings of the array and stores their ids
+
+	\param[in] strings the strings to intern
+	\param[out] ids the id of each string, the array is resized to match
+	*/
+	template<typename P1, typename P2>
+	void intern(const MayaArray<MStringArray, P1>& strings, MayaArray<MIntArray, P2>& ids) {
+		ids.resize(strings.size());
+		for (size_type i = 0; i < strings.size(); ++i)
+			ids[i] = static_cast<int>(intern(MayaStringView(strings[i])));
+	}
+
+	/**
+	Returns the id of the string if it has been interned
+
+	\param[in] value the string to look up
+
+	\return
+	id of the string, or -1 if it was not interned
+	*/
+	int find(MayaStringView value) const {
+		if (mSlots.empty())
+			return -1;
+		std::size_t slot = probe(value, value.hash());
+		return mSlots[slot] ? static_cast<int>(mSlots[slot] - 1) : -1;
+	}
+
+	/**
+	Returns the string of the id
+
+	\param[in] id id of the string
+
+	\return
+	view of the string
+	*/
+	inline MayaStringView operator[](size_type id) const {
+		return mStrings[id];
+	}
+
+	/**
+	Returns the Maya interned string of the id, interning it with Maya the first time
+
+	\param[in] id id of the string
+
+	\return
+	the MUniqueString
+	*/
+	const MUniqueString& unique(size_type id) {
+		assert(id < size());
+		if (mUnique.size() < size()) {
+			mUnique.resize(size());
+			mHasUnique.resize(size(), false);
+		}
+		if (!mHasUnique[id]) {
+			mUnique[id] = MUniqueString::intern(mStrings[id].toMString());
+			mHasUnique[id] = true;
+		}
+		return mUnique[id];
+	}
+
+	/**
+	Converts an array of ids to the Maya interned strings, interning each
+	distinct string with Maya only once
+
+	\param[in] ids ids of interned strings
+	\param[out] strings the strings, resized to match the ids
+	*/
+	template<typename P>
+	void toUniqueStrings(const MayaArray<MIntArray, P>& ids, std::vector<MUniqueString>& strings) {
+		strings.resize(ids.size());
+		for (size_type i = 0; i < ids.size(); ++i)
+			strings[i] = unique(static_cast<size_type>(ids[i]));
+	}
+
+	/**
+	Returns the number of distinct strings
+
+	\return
+	number of strings
+	*/
+	inline size_type size() const {
+		return mStrings.size();
+	}
+
+	inline bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	Returns the strings in the order of their ids
+
+	\return
+	the strings
+	*/
+	inline const MayaStringArena& strings() const {
+		return mStrings;
+	}
+
+	/**
+	Removes all strings, keeping the memory
+	*/
+	void clear() {
+		mStrings.clear();
+		mHashes.clear();
+		mUnique.clear();
+		mHasUnique.clear();
+		std::fill(mSlots.begin(), mSlots.end(), 0u);
+	}
+
+protected:
+	// slot of the string, or of the empty slot where it would go
+	std::size_t probe(MayaStringView value, std::size_t hash) const {
+		const std::size_t mask = mSlots.size() - 1;
+		std::size_t slot = hash & mask;
+		while (mSlots[slot]) {
+			const size_type id = mSlots[slot] - 1;
+			if (mHashes[id] == hash && mStrings[id] == value)
+				break;
+			slot = (slot + 1) & mask;
+		}
+		return slot;
+	}
+
+	void rehash(std::size_t slotCount) {
+		mSlots.assign(slotCount, 0u);
+		const std::size_t mask = slotCount - 1;
+		for (size_type id = 0; id < size(); ++id) {
+			std::size_t slot = mHashes[id] & mask;
+			while (mSlots[slot])
+				slot = (slot + 1) & mask;
+			mSlots[slot] = id + 1;
+		}
+	}
+
+	MayaStringArena mStrings;
+	std::vector<std::size_t> mHashes;
+	// open addressing table of id + 1, 0 for an empty slot, at most half full
+	std::vector<size_type> mSlots;
+	std::vector<MUniqueString> mUnique;
+	std::vector<bool> mHasUnique;
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_STRING_ARENA_H_
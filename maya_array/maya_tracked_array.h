@@ -0,0 +1,764 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_TRACKED_ARRAY_H_
+#define MAYAARRAY_MAYA_TRACKED_ARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <maya_array/maya_array.h>
+
+namespace mayaarray {
+
+/*
+A half open range of indices, from "first" up to but not including "last"
+*/
+struct MayaIndexRange {
+	unsigned int first;
+	unsigned int last;
+
+	unsigned int size() const {
+		return last - first;
+	}
+
+	bool operator==(const MayaIndexRange& other) const {
+		return first == other.first && last == other.last;
+	}
+
+	bool operator!=(const MayaIndexRange& other) const {
+		return !(*this == other);
+	}
+};
+
+/**
+Maya Dirty Ranges Class
+
+DESCRIPTION:
+A set of indices stored as sorted ranges that do not overlap or touch. Marking
+an index next to or inside the last marked range extends that range in
+constant time, so writing an array in order collapses into a single range.
+Ranges marked out of order are merged the next time the ranges are read, or
+when enough of them have been added.
+
+This class is not thread safe. Threads writing different parts of an array
+should each keep their own set and merge them with "mark" afterwards.
+
+USAGE:
+	mayaarray::MayaDirtyRanges dirty;
+	dirty.mark(10);
+	dirty.mark(11);
+	dirty.mark(100, 200);
+	for (const mayaarray::MayaIndexRange& range : dirty.ranges()) {
+		// range is [10, 12) then [100, 200)
+	}
+*/
+class MayaDirtyRanges {
+public:
+	typedef unsigned int size_type;
+	typedef std::vector<MayaIndexRange>::const_iterator const_iterator;
+
+	MayaDirtyRanges() : mMerged(0) {}
+
+	/**
+	Marks a single index
+
+	\param[in] index the index to mark
+	*/
+	inline void mark(size_type index) {
+		mark(index, index + 1);
+	}
+
+	/**
+	Marks the indices from "first" up to but not including "last"
+
+	\param[in] first first index to mark
+	\param[in] last one past the last index to mark
+	*/
+	void mark(size_type first, size_type last) {
+		if (last <= first)
+			return;
+		if (!mRanges.empty()) {
+			MayaIndexRange& back = mRanges.back();
+			if (first <= back.last && back.first <= last) {
+				// growing the last range down may make it reach the ones before it
+				if (first < back.first && mMerged == mRanges.size())
+					--mMerged;
+				back.first = std::min(back.first, first);
+				back.last = std::max(back.last, last);
+				return;
+			}
+		}
+		MayaIndexRange range = { first, last };
+		mRanges.push_back(range);
+		// merge once the unmerged ranges outnumber the merged ones, so scattered
+		// writes keep the memory proportional to the number of separate ranges
+		if (2 * mMerged + kMergeSlack < mRanges.size())
+			merge();
+	}
+
+	/**
+	Marks all indices of another set
+
+	\param[in] other set of indices to mark
+	*/
+	void mark(const MayaDirtyRanges& other) {
+		const std::vector<MayaIndexRange>& otherRanges = other.ranges();
+		for (std::size_t i = 0; i < otherRanges.size(); ++i)
+			mark(otherRanges[i].first, otherRanges[i].last);
+	}
+
+	/**
+	Removes all indices at or after "size", for when the array shrinks
+
+	\param[in] size the new size of the array
+	*/
+	void truncate(size_type size) {
+		merge();
+		while (!mRanges.empty() && size <= mRanges.back().first)
+			mRanges.pop_back();
+		if (!mRanges.empty() && size < mRanges.back().last)
+			mRanges.back().last = size;
+		mMerged = mRanges.size();
+	}
+
+	/**
+	Removes all indices
+	*/
+	inline void clear() {
+		mRanges.clear();
+		mMerged = 0;
+	}
+
+	/**
+	Returns true if no indices are marked
+
+	\return
+	true if empty
+	*/
+	inline bool empty() const {
+		return mRanges.empty();
+	}
+
+	/**
+	Returns the marked indices as sorted ranges that do not overlap or touch
+
+	\return
+	the ranges
+	*/
+	const std::vector<MayaIndexRange>& ranges() const {
+		merge();
+		return mRanges;
+	}
+
+	const_iterator begin() const {
+		return ranges().begin();
+	}
+
+	const_iterator end() const {
+		return ranges().end();
+	}
+
+	/**
+	Returns the number of marked indices
+
+	\return
+	number of indices
+	*/
+	size_type count() const {
+		merge();
+		size_type total = 0;
+		for (std::size_t i = 0; i < mRanges.size(); ++i)
+			total += mRanges[i].size();
+		return total;
+	}
+
+	/**
+	Returns true if the index is marked
+
+	\param[in] index the index to look up
+
+	\return
+	true if marked
+	*/
+	bool contains(size_type index) const {
+		merge();
+		std::vector<MayaIndexRange>::const_iterator it = std::upper_bound(mRanges.begin(), mRanges.end(), index,
+			[](size_type i, const MayaIndexRange& range) { return i < range.first; });
+		return it != mRanges.begin() && index < (it - 1)->last;
+	}
+
+protected:
+	// unmerged ranges allowed before merging small sets
+	static const std::size_t kMergeSlack = 64;
+
+	// sorts the ranges and joins the ones that overlap or touch
+	void merge() const {
+		if (mMerged == mRanges.size())
+			return;
+		std::sort(mRanges.begin(), mRanges.end(),
+			[](const MayaIndexRange& a, const MayaIndexRange& b) { return a.first < b.first; });
+		std::size_t out = 0;
+		for (std::size_t i = 1; i < mRanges.size(); ++i) {
+			if (mRanges[i].first <= mRanges[out].last)
+				mRanges[out].last = std::max(mRanges[out].last, mRanges[i].last);
+			else
+				mRanges[++out] = mRanges[i];
+		}
+		mRanges.resize(out + 1);
+		mMerged = mRanges.size();
+	}
+
+	// merging only reorders the same indices, so it is allowed on a const set
+	mutable std::vector<MayaIndexRange> mRanges;
+	// number of ranges at the front that are sorted and merged
+	mutable std::size_t mMerged;
+};
+
+/**
+Maya Tracked Array Class Template
+
+DESCRIPTION:
+A MayaArray that records which elements were written, so a deformer or tool
+that changes a few hundred points of a dense mesh can recompute and write back
+only those points instead of the whole array.
+
+Elements are marked dirty when they are reached through the non-const
+iterators, the non-const "[]" operator, "at", "front", "back" or "set", and
+when they are added by "push_back" or "resize". Getting a mutable reference
+counts as a write, even if nothing is assigned through it. Reading through a
+const reference or "cbegin" and "cend" does not mark anything. Changes made
+directly through "array()" or "data()" are not tracked and must be marked
+with "markDirty". Inserting or erasing moves the following elements, so
+everything from the position to the end is marked.
+
+After the dirty elements have been consumed call "clearDirty". A new array
+starts with nothing marked; call "markAllDirty" if its consumer has not seen
+the contents yet.
+
+A non-const iterator holds a pointer to the tracked array and an index, and
+is invalidated by the same operations that invalidate MayaArray iterators.
+The tracking is not thread safe; parallel writers should write through
+"array()" or "data()" and mark the ranges they wrote afterwards.
+
+USAGE:
+	mayaarray::MayaTrackedArray<MPointArray> points(restPoints);
+
+	// a brush stroke moves a few points
+	for (int index : affected)
+		points[index] += offset * weights[index];
+
+	// write back only what changed
+	for (const mayaarray::MayaIndexRange& range : points.dirtyRanges()) {
+		for (unsigned int i = range.first; i < range.last; ++i)
+			iter.setPosition(i, points.cref(i));
+	}
+	points.clearDirty();
+*/
+template<typename T, typename Policy=mayaiteration::default_iterator_policy>
+class MayaTrackedArray {
+public:
+	typedef MayaArray<T, Policy> array_type;
+	typedef typename array_type::reference reference;
+	typedef typename array_type::const_reference const_reference;
+	typedef typename array_type::value_type value_type;
+	typedef typename array_type::size_type size_type;
+	typedef typename array_type::const_iterator const_iterator;
+
+	/*
+	Random access iterator that marks every element it dereferences
+	*/
+	class iterator {
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef typename MayaTrackedArray::value_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef typename std::remove_reference<typename MayaTrackedArray::reference>::type* pointer;
+		typedef typename MayaTrackedArray::reference reference;
+
+		iterator() : mOwner(nullptr), mIndex(0) {}
+		iterator(MayaTrackedArray* owner, size_type index) : mOwner(owner), mIndex(index) {}
+
+		reference operator*() const {
+			return mOwner->writeAt(mIndex);
+		}
+
+		pointer operator->() const {
+			return &mOwner->writeAt(mIndex);
+		}
+
+		reference operator[](difference_type n) const {
+			return mOwner->writeAt(static_cast<size_type>(mIndex + n));
+		}
+
+		iterator& operator++() {
+			++mIndex;
+			return *this;
+		}
+
+		iterator& operator--() {
+			--mIndex;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++mIndex;
+			return previous;
+		}
+
+		iterator operator--(int) {
+			iterator previous(*this);
+			--mIndex;
+			return previous;
+		}
+
+		iterator& operator+=(difference_type n) {
+			mIndex = static_cast<size_type>(mIndex + n);
+			return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+			mIndex = static_cast<size_type>(mIndex - n);
+			return *this;
+		}
+
+		iterator operator+(difference_type n) const {
+			return iterator(mOwner, static_cast<size_type>(mIndex + n));
+		}
+
+		friend iterator operator+(difference_type n, const iterator& it) {
+			return it + n;
+		}
+
+		iterator operator-(difference_type n) const {
+			return iterator(mOwner, static_cast<size_type>(mIndex - n));
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return static_cast<difference_type>(mIndex) - static_cast<difference_type>(other.mIndex);
+		}
+
+		bool operator==(const iterator& other) const { return mIndex == other.mIndex; }
+		bool operator!=(const iterator& other) const { return mIndex != other.mIndex; }
+		bool operator<(const iterator& other) const { return mIndex < other.mIndex; }
+		bool operator>(const iterator& other) const { return other.mIndex < mIndex; }
+		bool operator<=(const iterator& other) const { return !(other.mIndex < mIndex); }
+		bool operator>=(const iterator& other) const { return !(mIndex < other.mIndex); }
+
+		// index of the element in the array
+		size_type index() const {
+			return mIndex;
+		}
+
+	protected:
+		MayaTrackedArray* mOwner;
+		size_type mIndex;
+	};
+
+	/**
+	Creates an empty array
+	*/
+	MayaTrackedArray() {}
+
+	/**
+	Creates an array with a copy of the values of the given array, with nothing marked
+
+	\param[in] values the array to copy
+	*/
+	explicit MayaTrackedArray(const array_type& values) : mArray(values) {}
+
+	/**
+	Creates an array that takes over the contents of the given array, with nothing marked
+
+	\param[in] values the array to take the contents of
+	*/
+	explicit MayaTrackedArray(array_type&& values) : mArray(std::move(values)) {}
+
+	/**
+	Creates an array with a copy of the given M***Array instance, with nothing marked
+
+	\param[in] maya_array the Maya array to copy
+	*/
+	explicit MayaTrackedArray(const T& maya_array) : mArray(maya_array) {}
+
+	/**
+	Returns the values without tracking reads. The array can be passed to Maya
+	functions that fill an array, but the written elements must then be marked
+	with "markDirty".
+
+	\return
+	the values
+	*/
+	inline array_type& values() {
+		return mArray;
+	}
+
+	inline const array_type& values() const {
+		return mArray;
+	}
+
+	/**
+	Returns the M***Array instance, see "values"
+
+	\return
+	the Maya array
+	*/
+	inline T& array() {
+		return mArray.array();
+	}
+
+	inline const T& array() const {
+		return mArray.array();
+	}
+
+	/**
+	Returns a pointer to the first value of contiguous arrays, writes through it are not tracked
+
+	\return
+	pointer to the first value
+	*/
+	inline value_type* data() {
+		return mArray.data();
+	}
+
+	inline const value_type* data() const {
+		return mArray.data();
+	}
+
+	inline iterator begin() {
+		return iterator(this, 0);
+	}
+
+	inline iterator end() {
+		return iterator(this, size());
+	}
+
+	inline const_iterator begin() const {
+		return mArray.begin();
+	}
+
+	inline const_iterator end() const {
+		return mArray.end();
+	}
+
+	inline const_iterator cbegin() const {
+		return mArray.cbegin();
+	}
+
+	inline const_iterator cend() const {
+		return mArray.cend();
+	}
+
+	/**
+	Returns a reference to the value at the position and marks it dirty
+
+	\param[in] pos position in the array
+
+	\return
+	reference to the value
+	*/
+	inline reference operator[](size_type pos) {
+		return writeAt(pos);
+	}
+
+	inline const_reference operator[](size_type pos) const {
+		return mArray[pos];
+	}
+
+	/**
+	Returns a const reference to the value at the position without marking it,
+	for reading from a non-const array
+
+	\param[in] pos position in the array
+
+	\return
+	const reference to the value
+	*/
+	inline const_reference cref(size_type pos) const {
+		return mArray[pos];
+	}
+
+	/**
+	Like the [] operator, but throws a out_of_range exception if the position
+	is not within bounds of the array.
+
+	\param[in] pos position in the array
+
+	\return
+	reference to the value
+	*/
+	reference at(size_type pos) {
+		reference value = mArray.at(pos);
+		mDirty.mark(pos);
+		return value;
+	}
+
+	const_reference at(size_type pos) const {
+		return mArray.at(pos);
+	}
+
+	inline reference front() {
+		return writeAt(0);
+	}
+
+	inline const_reference front() const {
+		return mArray.front();
+	}
+
+	inline reference back() {
+		return writeAt(size() - 1);
+	}
+
+	inline const_reference back() const {
+		return mArray.back();
+	}
+
+	/**
+	Assigns the value at the position only if it is different, so writing the
+	same value does not mark it
+
+	\param[in] pos position in the array
+	\param[in] value the new value
+	*/
+	void set(size_type pos, const value_type& value) {
+		if (!(mArray[pos] == value)) {
+			mArray[pos] = value;
+			mDirty.mark(pos);
+		}
+	}
+
+	inline size_type size() const {
+		return mArray.size();
+	}
+
+	inline bool empty() const {
+		return mArray.size() == 0;
+	}
+
+	inline void reserve(size_type count) {
+		mArray.reserve(count);
+	}
+
+	/**
+	Appends the value and marks it dirty
+
+	\param[in] value value to append
+	*/
+	void push_back(const value_type& value) {
+		mArray.push_back(value);
+		mDirty.mark(size() - 1);
+	}
+
+	/**
+	Resizes the array, marking the new elements dirty if it grows and dropping
+	the marks past the end if it shrinks
+
+	\param[in] count the new size
+	*/
+	void resize(size_type count) {
+		size_type oldSize = size();
+		mArray.resize(count);
+		resized(oldSize);
+	}
+
+	/**
+	Resizes the array, filling new elements with the value and marking them dirty
+
+	\param[in] count the new size
+	\param[in] value the value of new elements
+	*/
+	void resize(size_type count, const value_type& value) {
+		size_type oldSize = size();
+		mArray.resize(count, value);
+		resized(oldSize);
+	}
+
+	/**
+	Inserts a value and marks everything from the position to the end, since
+	those elements moved
+
+	\param[in] pos position to insert at
+	\param[in] value value to insert
+
+	\return
+	iterator to the inserted value
+	*/
+	iterator insert(size_type pos, const value_type& value) {
+		mArray.insert(mArray.cbegin() + pos, value);
+		mDirty.mark(pos, size());
+		return iterator(this, pos);
+	}
+
+	/**
+	Erases the elements from "first" up to but not including "last" and marks
+	everything from "first" to the new end, since those elements moved
+
+	\param[in] first first position to erase
+	\param[in] last one past the last position to erase
+
+	\return
+	iterator to the first element after the erased ones
+	*/
+	iterator erase(size_type first, size_type last) {
+		mArray.erase(mArray.cbegin() + first, mArray.cbegin() + last);
+		mDirty.truncate(size());
+		mDirty.mark(first, size());
+		return iterator(this, first);
+	}
+
+	/**
+	Removes all elements and all marks
+	*/
+	void clear() {
+		mArray.clear();
+		mDirty.clear();
+	}
+
+	/**
+	Marks the elements from "first" up to but not including "last" as dirty,
+	for writes made through "values", "array" or "data"
+
+	\param[in] first first position to mark
+	\param[in] last one past the last position to mark
+	*/
+	inline void markDirty(size_type first, size_type last) {
+		mDirty.mark(first, std::min(last, size()));
+	}
+
+	/**
+	Marks a single element as dirty
+
+	\param[in] pos position to mark
+	*/
+	inline void markDirty(size_type pos) {
+		if (pos < size())
+			mDirty.mark(pos);
+	}
+
+	/**
+	Marks all elements as dirty
+	*/
+	inline void markAllDirty() {
+		mDirty.mark(0, size());
+	}
+
+	/**
+	Removes all marks, after the dirty elements have been consumed
+	*/
+	inline void clearDirty() {
+		mDirty.clear();
+	}
+
+	/**
+	Returns true if any element is marked
+
+	\return
+	true if something changed
+	*/
+	inline bool isDirty() const {
+		return !mDirty.empty();
+	}
+
+	/**
+	Returns true if the element at the position is marked
+
+	\param[in] pos position in the array
+
+	\return
+	true if the element changed
+	*/
+	inline bool isDirty(size_type pos) const {
+		return mDirty.contains(pos);
+	}
+
+	/**
+	Returns the marked elements as sorted ranges that do not overlap or touch
+
+	\return
+	the dirty ranges
+	*/
+	inline const std::vector<MayaIndexRange>& dirtyRanges() const {
+		return mDirty.ranges();
+	}
+
+	/**
+	Returns the number of marked elements
+
+	\return
+	number of dirty elements
+	*/
+	inline size_type dirtyCount() const {
+		return mDirty.count();
+	}
+
+	/**
+	Returns the set of marked elements
+
+	\return
+	the dirty set
+	*/
+	inline const MayaDirtyRanges& dirty() const {
+		return mDirty;
+	}
+
+	/**
+	Copies only the dirty elements to the same positions of another array, for
+	keeping a downstream copy, such as a mapped GPU buffer or the output of a
+	node, up to date. The destination must have at least as many elements as
+	this array.
+
+	\param[in] dest random access range or pointer to copy the values to
+	*/
+	template<typename Dest>
+	void copyDirty(Dest&& dest) const {
+		const std::vector<MayaIndexRange>& ranges = mDirty.ranges();
+		for (std::size_t r = 0; r < ranges.size(); ++r) {
+			for (size_type i = ranges[r].first; i < ranges[r].last; ++i)
+				dest[i] = mArray[i];
+		}
+	}
+
+protected:
+	reference writeAt(size_type pos) {
+		mDirty.mark(pos);
+		return mArray[pos];
+	}
+
+	void resized(size_type oldSize) {
+		if (size() < oldSize)
+			mDirty.truncate(size());
+		else
+			mDirty.mark(oldSize, size());
+	}
+
+	array_type mArray;
+	MayaDirtyRanges mDirty;
+};
+
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_TRACKED_ARRAY_H_
@@ -0,0 +1,283 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAARRAY_MAYA_VERTEX_PACKING_H_
+#define MAYAARRAY_MAYA_VERTEX_PACKING_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <maya/MPoint.h>
+#include <maya/MVector.h>
+#include <maya_array/maya_array_kernels.h>
+#include <maya_iteration/maya_parallel.h>
+
+namespace mayaarray {
+namespace kernels {
+
+/*
+Default number of vertices each task packs. Packing is limited by memory
+bandwidth, so the tasks are larger than for the other parallel functions.
+*/
+const unsigned int kPackGrainSize = 16384;
+
+namespace detail {
+
+// calls func(first, last) on chunks of the vertices, in parallel for large counts
+template<typename Func>
+void packChunks(unsigned int count, unsigned int grainSize, Func func) {
+	if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD || count <= grainSize) {
+		func(0u, count);
+		return;
+	}
+	tbb::parallel_for(tbb::blocked_range<unsigned int>(0, count, std::max(grainSize, 1u)),
+		[&](const tbb::blocked_range<unsigned int>& chunk) {
+			func(chunk.begin(), chunk.end());
+		});
+}
+
+inline void uvsToFloat2(const float* u, const float* v, float* out, std::size_t count, std::size_t stride) {
+	for (std::size_t i = 0; i < count; ++i, out += stride) {
+		out[0] = u[i];
+		out[1] = v[i];
+	}
+}
+
+} // namespace detail
+
+/**
+Converts the x, y and z of every point to floats and writes them to the
+buffer, dropping w. This is the layout of a float3 position stream of a
+Viewport 2.0 vertex buffer, and the buffer can be the pointer returned by
+MHWRender::MVertexBuffer::acquire. The points are expected to be cartesian.
+
+\param[in] points contiguous range of MPoint, such as a MayaArray<MPointArray>
+\param[out] out buffer with room for the points
+\param[in] stride number of floats from one vertex to the next, 3 for a packed stream
+\param[in] grainSize number of vertices packed by each task, 0 is treated as 1
+*/
+template<typename PointRange>
+void packPoints(const PointRange& points, float* out, unsigned int stride=3, unsigned int grainSize=kPackGrainSize) {
+	assert(3 <= stride);
+	const MPoint* in = detail::elements<const MPoint>(points);
+	const detail::KernelTable& table = detail::kernelTable();
+	detail::packChunks(points.size(), grainSize, [&](unsigned int first, unsigned int last) {
+		table.pointsToFloat3(in + first, out + static_cast<std::size_t>(first) * stride, last - first, stride);
+	});
+}
+
+/**
+Converts the x, y and z of every vector to floats and writes them to the
+buffer, such as a float3 normal or tangent stream of a vertex buffer.
+
+\param[in] vectors contiguous range of MVector, such as a MayaArray<MVectorArray>
+\param[out] out buffer with room for the vectors
+\param[in] stride number of floats from one vertex to the next, 3 for a packed stream
+\param[in] grainSize number of vertices packed by each task, 0 is treated as 1
+*/
+template<typename VectorRange>
+void packVectors(const VectorRange& vectors, float* out, unsigned int stride=3, unsigned int grainSize=kPackGrainSize) {
+	assert(3 <= stride);
+	const MVector* in = detail::elements<const MVector>(vectors);
+	const detail::KernelTable& table = detail::kernelTable();
+	detail::packChunks(vectors.size(), grainSize, [&](unsigned int first, unsigned int last) {
+		table.vectorsToFloat3(in + first, out + static_cast<std::size_t>(first) * stride, last - first, stride);
+	});
+}
+
+/**
+Converts every double of the range to a float, for streams that Maya stores
+as doubles but are drawn with floats, such as per vertex weights.
+
+\param[in] values contiguous range of double, such as a MayaArray<MDoubleArray>
+\param[out] out buffer with room for the values
+\param[in] grainSize number of values converted by each task
+*/
+template<typename DoubleRange>
+void packDoubles(const DoubleRange& values, float* out, unsigned int grainSize=kPackGrainSize) {
+	const double* in = detail::elements<const double>(values);
+	const detail::KernelTable& table = detail::kernelTable();
+	detail::packChunks(values.size(), grainSize, [&](unsigned int first, unsigned int last) {
+		table.doublesToFloats(in + first, out + first, last - first);
+	});
+}
+
+/**
+Interleaves separate u and v arrays, such as from MFnMesh::getUVs, into a
+float2 texture coordinate stream. They are already floats, so they are only
+copied.
+
+\param[in] u contiguous range of float with the u coordinates
+\param[in] v contiguous range of float with the v coordinates, the same size as u
+\param[out] out buffer with room for the coordinates
+\param[in] stride number of floats from one vertex to the next, 2 for a packed stream
+\param[in] grainSize number of vertices packed by each task, 0 is treated as 1
+*/
+template<typename URange, typename VRange>
+void packUVs(const URange& u, const VRange& v, float* out, unsigned int stride=2, unsigned int grainSize=kPackGrainSize) {
+	assert(2 <= stride && u.size() == v.size());
+	const float* inU = detail::elements<const float>(u);
+	const float* inV = detail::elements<const float>(v);
+	detail::packChunks(u.size(), grainSize, [&](unsigned int first, unsigned int last) {
+		detail::uvsToFloat2(inU + first, inV + first, out + static_cast<std::size_t>(first) * stride, last - first, stride);
+	});
+}
+
+/**
+Vertex Streams Class
+
+DESCRIPTION:
+The position, normal and uv streams of a mesh to write into one interleaved
+vertex buffer with "packInterleaved". Each vertex is the float3 position,
+followed by the float3 normal and the float2 uv for the streams that are set,
+so the stride is 3, 6 or 8 floats. The streams point into the given ranges,
+which must stay alive and unchanged until the streams are packed.
+
+USAGE:
+	mayaarray::kernels::VertexStreams streams;
+	streams.setPositions(points).setNormals(normals).setUVs(u, v);
+	mayaarray::kernels::packInterleaved(streams, bufferPointer);
+*/
+class VertexStreams {
+public:
+	VertexStreams() : mPositions(nullptr), mNormals(nullptr), mU(nullptr), mV(nullptr), mCount(0) {}
+
+	/**
+	Sets the positions, which also sets the number of vertices
+
+	\param[in] points contiguous range of MPoint
+	*/
+	template<typename PointRange>
+	VertexStreams& setPositions(const PointRange& points) {
+		mPositions = detail::elements<const MPoint>(points);
+		mCount = points.size();
+		return *this;
+	}
+
+	/**
+	Sets the normals, which must have one vector per position
+
+	\param[in] normals contiguous range of MVector
+	*/
+	template<typename VectorRange>
+	VertexStreams& setNormals(const VectorRange& normals) {
+		assert(normals.size() == mCount);
+		mNormals = detail::elements<const MVector>(normals);
+		return *this;
+	}
+
+	/**
+	Sets the uvs, which must have one coordinate per position
+
+	\param[in] u contiguous range of float with the u coordinates
+	\param[in] v contiguous range of float with the v coordinates
+	*/
+	template<typename URange, typename VRange>
+	VertexStreams& setUVs(const URange& u, const VRange& v) {
+		assert(u.size() == mCount && v.size() == mCount);
+		mU = detail::elements<const float>(u);
+		mV = detail::elements<const float>(v);
+		return *this;
+	}
+
+	/**
+	Returns the number of vertices
+
+	\return
+	number of vertices
+	*/
+	inline unsigned int size() const {
+		return mCount;
+	}
+
+	/**
+	Returns the number of floats of one interleaved vertex
+
+	\return
+	number of floats per vertex
+	*/
+	inline unsigned int stride() const {
+		return 3 + (mNormals ? 3 : 0) + (mU ? 2 : 0);
+	}
+
+	/**
+	Returns the offset in floats of the normal within a vertex
+
+	\return
+	float offset of the normal, only meaningful if normals are set
+	*/
+	inline unsigned int normalOffset() const {
+		return 3;
+	}
+
+	/**
+	Returns the offset in floats of the uv within a vertex
+
+	\return
+	float offset of the uv, only meaningful if uvs are set
+	*/
+	inline unsigned int uvOffset() const {
+		return mNormals ? 6 : 3;
+	}
+
+	const MPoint* positions() const { return mPositions; }
+	const MVector* normals() const { return mNormals; }
+	const float* u() const { return mU; }
+	const float* v() const { return mV; }
+
+protected:
+	const MPoint* mPositions;
+	const MVector* mNormals;
+	const float* mU;
+	const float* mV;
+	unsigned int mCount;
+};
+
+/**
+Writes the streams as one interleaved vertex buffer, see VertexStreams for the
+layout. Each task converts all streams of its own vertices, so every vertex is
+written while its inputs are in the cache.
+
+\param[in] streams the streams to pack, the positions must be set
+\param[out] out buffer with room for size() * stride() floats
+\param[in] grainSize number of vertices packed by each task, 0 is treated as 1
+*/
+inline void packInterleaved(const VertexStreams& streams, float* out, unsigned int grainSize=kPackGrainSize) {
+	assert(streams.positions() || streams.size() == 0);
+	const detail::KernelTable& table = detail::kernelTable();
+	const std::size_t stride = streams.stride();
+	detail::packChunks(streams.size(), grainSize, [&](unsigned int first, unsigned int last) {
+		float* vertex = out + first * stride;
+		const unsigned int count = last - first;
+		table.pointsToFloat3(streams.positions() + first, vertex, count, stride);
+		if (streams.normals())
+			table.vectorsToFloat3(streams.normals() + first, vertex + streams.normalOffset(), count, stride);
+		if (streams.u())
+			detail::uvsToFloat2(streams.u() + first, streams.v() + first, vertex + streams.uvOffset(), count, stride);
+	});
+}
+
+} // namespace kernels
+} // namespace mayaarray
+
+#endif // MAYAARRAY_MAYA_VERTEX_PACKING_H_
@@ -0,0 +1,341 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef MAYAITERATION_MAYA_ARRAY_DATA_RANGE_H_
+#define MAYAITERATION_MAYA_ARRAY_DATA_RANGE_H_
+
+#include <iterator>
+#include <maya/MArrayDataBuilder.h>
+#include <maya/MArrayDataHandle.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MFloatVector.h>
+#include <maya/MIntArray.h>
+#include <maya/MMatrix.h>
+#include <maya/MVector.h>
+#include <maya_array/maya_array.h>
+
+namespace mayaiteration {
+
+/*
+An element of a multi-instance attribute, with its logical index and its data
+*/
+struct MayaArrayDataElement {
+	unsigned int index;
+	MDataHandle data;
+};
+
+/**
+Maya Array Data Range Class
+
+DESCRIPTION:
+Wraps a MArrayDataHandle for a multi-instance attribute and provides an
+iterator over its elements, the same way MayaArrayRange does for Maya arrays.
+Dereferencing the iterator returns a MayaArrayDataElement with the logical
+index of the element and its data handle, which is the input value or the
+output value depending on how the range was created. The handle is moved with
+"next" when iterating in order and only jumps when elements are skipped.
+
+Because the handle has a single current element, the iterators are input
+iterators, and only one element of a range should be used at a time.
+
+USAGE:
+	MArrayDataHandle matricesHandle = data.inputArrayValue(aMatrix);
+	for (auto& element : mayaiteration::MayaArrayDataRange(matricesHandle))
+		matrices[element.index] = element.data.asMatrix();
+
+	// skin cluster style weightList[].weights[]
+	MArrayDataHandle weightListHandle = data.inputArrayValue(aWeightList);
+	for (auto& vertex : mayaiteration::MayaArrayDataRange(weightListHandle)) {
+		MArrayDataHandle weightsHandle(vertex.data.child(aWeights));
+		mayaiteration::readDense(weightsHandle, weights, influenceCount, 0.0);
+	}
+*/
+class MayaArrayDataRange {
+public:
+	typedef unsigned int size_type;
+
+	class iterator {
+	friend class MayaArrayDataRange;
+
+	public:
+		typedef std::input_iterator_tag iterator_category;
+		typedef MayaArrayDataElement value_type;
+		typedef int difference_type;
+		typedef MayaArrayDataElement* pointer;
+		typedef MayaArrayDataElement& reference;
+
+		iterator() : r(nullptr), i(0) {}
+
+		reference operator*() const {
+			r->seek(i);
+			return r->mElement;
+		}
+
+		pointer operator->() const {
+			return &**this;
+		}
+
+		iterator& operator++() {
+			++i;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++i;
+			return previous;
+		}
+
+		bool operator==(const iterator& other) const {
+			return (i == other.i && r == other.r);
+		}
+
+		bool operator!=(const iterator& other) const {
+			return !(*this == other);
+		}
+
+	protected:
+		MayaArrayDataRange* r;
+		size_type i;
+
+		iterator(MayaArrayDataRange& r, size_type i) : r(&r), i(i) {}
+	};
+
+	/**
+	Creates a range over all elements of the array data handle
+
+	\param[in] handle the array data handle
+	\param[in] output use the output value of the elements instead of the input value
+	*/
+	MayaArrayDataRange(MArrayDataHandle& handle, bool output=false)
+		: mHandle(handle), mSize(handle.elementCount()), mCurrent(kNoElement), mOutput(output) {}
+
+	iterator begin() {
+		return iterator(*this, 0);
+	}
+
+	iterator end() {
+		return iterator(*this, mSize);
+	}
+
+	/**
+	Returns the number of elements in the array data handle
+	*/
+	size_type size() const {
+		return mSize;
+	}
+
+	bool empty() const {
+		return mSize == 0;
+	}
+
+protected:
+	static const size_type kNoElement = ~0u;
+
+	MArrayDataHandle& mHandle;
+	size_type mSize;
+	size_type mCurrent;
+	bool mOutput;
+	MayaArrayDataElement mElement;
+
+	// moves the handle to the element at the physical position
+	void seek(size_type position) {
+		if (mCurrent == position)
+			return;
+		if (mCurrent + 1 == position && mCurrent != kNoElement)
+			mHandle.next();
+		else
+			mHandle.jumpToArrayElement(position);
+		mCurrent = position;
+		mElement.index = mHandle.elementIndex();
+		mElement.data = mOutput ? mHandle.outputValue() : mHandle.inputValue();
+	}
+};
+
+// reads and writes values of data handles, for the types used by the helpers below
+
+inline void getDataValue(MDataHandle& handle, double& value) { value = handle.asDouble(); }
+inline void getDataValue(MDataHandle& handle, float& value) { value = handle.asFloat(); }
+inline void getDataValue(MDataHandle& handle, int& value) { value = handle.asInt(); }
+inline void getDataValue(MDataHandle& handle, bool& value) { value = handle.asBool(); }
+inline void getDataValue(MDataHandle& handle, MMatrix& value) { value = handle.asMatrix(); }
+inline void getDataValue(MDataHandle& handle, MVector& value) { value = handle.asVector(); }
+inline void getDataValue(MDataHandle& handle, MFloatVector& value) { value = handle.asFloatVector(); }
+
+template<typename V>
+inline void setDataValue(MDataHandle& handle, const V& value) {
+	handle.set(value);
+}
+
+/**
+Reads the values of all elements of a multi-instance attribute into an array in
+element order, optionally with their logical indices. The arrays are sized once
+before they are filled.
+
+\param[in] handle the array data handle
+\param[out] values array for the element values, such as a MayaArray<MDoubleArray>
+\param[out] indices optional array for the logical indices of the elements, which may use a
+different iterator policy than the values
+*/
+template<typename T, typename P, typename PI=P>
+void readElements(MArrayDataHandle& handle, mayaarray::MayaArray<T, P>& values, mayaarray::MayaArray<MIntArray, PI>* indices=nullptr) {
+	MayaArrayDataRange range(handle);
+	values.resize(range.size());
+	if (indices)
+		indices->resize(range.size());
+	unsigned int i = 0;
+	for (MayaArrayDataRange::iterator it = range.begin(); it != range.end(); ++it, ++i) {
+		getDataValue(it->data, values[i]);
+		if (indices)
+			(*indices)[i] = static_cast<int>(it->index);
+	}
+}
+
+/**
+Reads a sparse multi-instance attribute into a dense array indexed by logical
+index, such as the weights of one vertex in a skin cluster style weight list.
+Elements that do not exist get the default value, and elements with a logical
+index past "count" are ignored.
+
+\param[in] handle the array data handle
+\param[out] values array that is resized to "count" elements
+\param[in] count number of elements in the dense array
+\param[in] defaultValue value of elements that do not exist
+*/
+template<typename T, typename P, typename V>
+void readDense(MArrayDataHandle& handle, mayaarray::MayaArray<T, P>& values, unsigned int count, const V& defaultValue) {
+	values.assign(count, defaultValue);
+	MayaArrayDataRange range(handle);
+	for (MayaArrayDataRange::iterator it = range.begin(); it != range.end(); ++it) {
+		if (it->index < count) {
+			getDataValue(it->data, values[it->index]);
+		}
+	}
+}
+
+/**
+Maya Array Data Output Class
+
+DESCRIPTION:
+Fills the output of a multi-instance attribute through a MArrayDataBuilder that
+is sized once for all elements, instead of growing it one "addElement" at a
+time. The elements are written to the handle with "commit" which also marks
+the handle clean.
+
+USAGE:
+	MArrayDataHandle outHandle = data.outputArrayValue(aOutWeights);
+	mayaiteration::MayaArrayDataOutput output(outHandle, weights.size());
+	for (unsigned int i = 0; i < weights.size(); ++i)
+		output.add(i).set(weights[i]);
+	output.commit();
+*/
+class MayaArrayDataOutput {
+public:
+	/**
+	Creates an output for the handle with room for "count" elements. The
+	elements that are in the handle already are kept.
+
+	\param[in] handle the output array data handle
+	\param[in] count number of elements that will be added
+	*/
+	MayaArrayDataOutput(MArrayDataHandle& handle, unsigned int count)
+		: mHandle(handle), mBuilder(handle.builder()) {
+		if (count)
+			mBuilder.growArray(count);
+	}
+
+	/**
+	Creates an output with a new builder for the attribute that is sized for
+	"count" elements. Existing elements of the handle are replaced on commit.
+
+	\param[in] handle the output array data handle
+	\param[in] block the data block of the node
+	\param[in] attribute the multi-instance attribute
+	\param[in] count number of elements that will be added
+	*/
+	MayaArrayDataOutput(MArrayDataHandle& handle, MDataBlock& block, const MObject& attribute, unsigned int count)
+		: mHandle(handle), mBuilder(&block, attribute, count) {}
+
+	/**
+	Adds the element at the logical index, or returns it if it already exists
+
+	\param[in] index logical index of the element
+
+	\return
+	data handle of the element
+	*/
+	MDataHandle add(unsigned int index) {
+		return mBuilder.addElement(index);
+	}
+
+	/**
+	Returns the builder for operations not covered here, such as adding
+	nested arrays
+	*/
+	MArrayDataBuilder& builder() {
+		return mBuilder;
+	}
+
+	/**
+	Sets the elements on the handle and marks it clean
+	*/
+	MStatus commit() {
+		MStatus status = mHandle.set(mBuilder);
+		if (status)
+			mHandle.setAllClean();
+		return status;
+	}
+
+protected:
+	MArrayDataHandle& mHandle;
+	MArrayDataBuilder mBuilder;
+};
+
+/**
+Writes all values of an array to the elements of a multi-instance output
+attribute, using the array index as the logical index. The builder is sized
+once and the handle is marked clean.
+
+\param[in] handle the output array data handle
+\param[in] block the data block of the node
+\param[in] attribute the multi-instance attribute
+\param[in] values array of values, such as a MayaArray<MDoubleArray>
+
+\return
+status of setting the elements on the handle
+*/
+template<typename T, typename P>
+MStatus writeElements(MArrayDataHandle& handle, MDataBlock& block, const MObject& attribute, const mayaarray::MayaArray<T, P>& values) {
+	MayaArrayDataOutput output(handle, block, attribute, values.size());
+	for (unsigned int i = 0; i < values.size(); ++i) {
+		MDataHandle data = output.add(i);
+		setDataValue(data, values[i]);
+	}
+	return output.commit();
+}
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_ARRAY_DATA_RANGE_H_
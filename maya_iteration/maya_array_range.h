@@ -27,15 +27,130 @@ THE SOFTWARE.
 
 #include <cassert>
 #include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <maya_array/maya_array_stats.h>
+#include <maya_templates/maya_array_traits.h>
 
 // forward declaration
 namespace mayaarray {
-template<typename T>
+template<typename T, typename Policy>
 class MayaArray;
 }
 
+// called by checked iterators when a check fails, it can be defined before
+// including this header to report the error another way
+#ifndef MAYAITERATION_ITERATOR_CHECK
+#define MAYAITERATION_ITERATOR_CHECK(condition, message) assert((condition) && message)
+#endif
+
 namespace mayaiteration {
 
+/*
+Iterator policies for MayaArrayRange and MayaArray.
+
+unchecked_iterators: iterators of contiguous arrays are plain pointers and the
+iterators of other arrays only hold the array and an index. Nothing is checked.
+
+checked_iterators: iterators check that they are in range when dereferenced
+and that compared iterators belong to the same array. Iterators of a MayaArray
+also keep the generation of the array they were created at, which changes when
+the array is changed in a way that can invalidate them such as "insert",
+"erase" or "resize", so using a stale iterator is caught.
+
+The default is unchecked iterators in every build, so the iterator types do not
+change with NDEBUG and translation units built with different settings agree on
+them. Checked iterators are chosen through the Policy template parameter.
+Arrays with different policies are different types.
+*/
+struct unchecked_iterators {};
+struct checked_iterators {};
+
+typedef unchecked_iterators default_iterator_policy;
+
+namespace detail {
+
+// the checks of unchecked iterators, which do nothing
+struct NoIteratorCheck {
+	NoIteratorCheck() {}
+	explicit NoIteratorCheck(const unsigned int*) {}
+
+	template<typename C>
+	void checkElement(const C*, unsigned int) const {}
+
+	void checkSame(const void*, const void*, const NoIteratorCheck&) const {}
+};
+
+// the checks of checked iterators, the generation source is null for arrays
+// that are not owned by a MayaArray
+struct GenerationIteratorCheck {
+	const unsigned int* mSource;
+	unsigned int mGeneration;
+
+	GenerationIteratorCheck() : mSource(nullptr), mGeneration(0) {}
+	explicit GenerationIteratorCheck(const unsigned int* source) : mSource(source), mGeneration(source ? *source : 0) {}
+
+	bool isCurrent() const {
+		return !mSource || *mSource == mGeneration;
+	}
+
+	template<typename C>
+	void checkElement(const C* c, unsigned int i) const {
+		// the parameters are unused when the check macro compiles to nothing
+		(void)c;
+		(void)i;
+		MAYAITERATION_ITERATOR_CHECK(c, "iterator does not belong to an array");
+		MAYAITERATION_ITERATOR_CHECK(isCurrent(), "iterator was invalidated by a change to the array");
+		MAYAITERATION_ITERATOR_CHECK(i < c->length(), "iterator is out of range");
+	}
+
+	void checkSame(const void* c, const void* otherC, const GenerationIteratorCheck& other) const {
+		(void)c;
+		(void)otherC;
+		(void)other;
+		MAYAITERATION_ITERATOR_CHECK(c == otherC, "iterators belong to different arrays");
+		MAYAITERATION_ITERATOR_CHECK(isCurrent() && other.isCurrent(), "iterator was invalidated by a change to the array");
+	}
+};
+
+// the generation of a MayaArray with unchecked iterators, which is not kept
+struct NoGenerationCounter {
+	const unsigned int* get() const {
+		return nullptr;
+	}
+
+	void bump() {}
+
+	void swap(NoGenerationCounter&) {}
+};
+
+// the generation of a MayaArray with checked iterators. It is kept on the heap
+// like the Maya array, so the iterators still find it after the MayaArray is
+// moved, such as when a std::vector of arrays grows. A moved from array gets a
+// new counter the next time it is changed.
+struct GenerationCounter {
+	std::unique_ptr<unsigned int> mValue;
+
+	GenerationCounter() : mValue(new unsigned int(0)) {}
+
+	const unsigned int* get() const {
+		return mValue.get();
+	}
+
+	void bump() {
+		if (!mValue)
+			mValue.reset(new unsigned int(0));
+		++*mValue;
+	}
+
+	void swap(GenerationCounter& other) {
+		mValue.swap(other.mValue);
+	}
+};
+
+} // namespace detail
+
 /**
 Maya Array Range Class Template
 
@@ -51,6 +166,14 @@ A MayaArrayRange instance provides the commonly used "begin()" and "end()"
 functions. These return either an iterator or a const iterator. See the
 std iterator documentation for more information on using the iterator instance.
 
+Maya arrays that store their elements contiguously, as reported by
+mayatemplates::is_contiguous_array, use plain pointers for their iterators unless
+the range uses checked iterators, and also provide "data()". This lets the
+standard library algorithms use their memmove and vectorized paths. Like
+std::vector iterators, these are invalidated when the array reallocates, such
+as after appending or inserting elements. The second template parameter picks
+the iterator policy, see checked_iterators.
+
 USAGE:
 	MPointArray myPointArray(5); // array of 5 points
 	mayaiteration::MayaArrayRange<MPointArray> myPointArrayRange(myPointArray);
@@ -79,48 +202,88 @@ USAGE:
 	// getting the number of points between two iterators
 	mayaiteration::MayaArrayRange<MPointArray>::iterator::difference_type dist = std::distance(beginIt, endIt);
 	std::cout << dist << std::endl;
+
+	// a range over the points from index 2 up to 4, it can be split in half
+	mayaiteration::MayaArrayRange<MPointArray> subRange(myPointArray, 2, 4);
+	mayaiteration::MayaArrayRange<MPointArray> secondHalf = subRange.split();
+
+	// ranges can be split by TBB, ranges in the body are copied to get mutable iterators
+	tbb::parallel_for(mayaiteration::MayaArrayRange<MPointArray>(myPointArray, 0, myPointArray.length(), 1024),
+		[&](const mayaiteration::MayaArrayRange<MPointArray>& r) {
+			mayaiteration::MayaArrayRange<MPointArray> chunk(r);
+			for (auto& pnt : chunk)
+				pnt *= matrix;
+		});
 */
-template<typename T>
+template<typename T, typename Policy=default_iterator_policy>
 class MayaArrayRange {
+	template<class A, class P>
+	friend class mayaarray::MayaArray;
+
 protected:
 	// there are different types returned based if the array is const or not
-	typedef typename decltype(std::declval<T>()[0]) ref_type;
-	typedef typename decltype(std::declval<const T>()[0]) const_ref_type;
+	typedef decltype(std::declval<T&>()[0]) ref_type;
+	typedef decltype(std::declval<const T&>()[0]) const_ref_type;
 	typedef typename std::remove_reference<ref_type>::type item_type;
+	typedef typename std::remove_reference<const_ref_type>::type const_item_type;
 
 public:
+	typedef unsigned int size_type;
+
+	typedef std::is_same<Policy, checked_iterators> is_checked;
+	typedef typename std::conditional<is_checked::value,
+		detail::GenerationIteratorCheck, detail::NoIteratorCheck>::type check_type;
+
 	template<typename C, typename V, typename R>
-	class MayaArrayIter : public std::iterator<std::random_access_iterator_tag, V, int, V*, R>	{
+	class MayaArrayIter : protected check_type {
 
 	friend class MayaArrayRange;
-	template<class A>
+	template<class A, class P>
 	friend class mayaarray::MayaArray;
+	template<typename C2, typename V2, typename R2>
+	friend class MayaArrayIter;
+
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef typename std::remove_const<V>::type value_type;
+		typedef int difference_type;
+		typedef V* pointer;
+		typedef R reference;
 
 	protected:
 		C* c;
 		unsigned int i;
 
-		MayaArrayIter(C& c) : c(&c), i(0) {}
-		MayaArrayIter(C& c, unsigned int i) : c(&c), i(i) {}
+		MayaArrayIter(C& c, unsigned int i, const unsigned int* generation) : check_type(generation), c(&c), i(i) {}
+
+		template<typename C2, typename V2, typename R2>
+		void checkSame(const MayaArrayIter<C2, V2, R2>& other) const {
+			check_type::checkSame(c, other.c, other);
+		}
 
 	public:
+		MayaArrayIter() : c(nullptr), i(0) {}
+
 		template<typename C2, typename V2, typename R2>
-		MayaArrayIter(const MayaArrayIter<C2, V2, R2>& other) : c(other.c), i(other.i) {}
+		MayaArrayIter(const MayaArrayIter<C2, V2, R2>& other) : check_type(other), c(other.c), i(other.i) {}
 		
 		template<typename C2, typename V2, typename R2>
 		MayaArrayIter& operator=(const MayaArrayIter<C2, V2, R2>& other) {
+			check_type::operator=(other);
 			c = other.c;
 			i = other.i;
 			return *this;
 		}
 
 		reference operator*() const	{
-			assert(i < c->length());
+			this->checkElement(c, i);
+			MAYAARRAY_COUNT(typename std::remove_const<C>::type, kCountDerefs, 1);
 			return (*c)[i];
 		}
 
 		pointer operator->() const {
-			assert(i < c->length());
+			this->checkElement(c, i);
+			MAYAARRAY_COUNT(typename std::remove_const<C>::type, kCountDerefs, 1);
 			return &(*c)[i];
 		}
 
@@ -135,15 +298,25 @@ public:
 		}
 
 		MayaArrayIter operator++(int) {
-			return MayaArrayIter(*c, i++);
+			MayaArrayIter previous(*this);
+			++i;
+			return previous;
 		}
 
 		MayaArrayIter operator--(int) {
-			return MayaArrayIter(*c, i--);
+			MayaArrayIter previous(*this);
+			--i;
+			return previous;
 		}
 
 		MayaArrayIter operator+(const difference_type& n) const	{
-			return MayaArrayIter(*c, (i + n));
+			MayaArrayIter result(*this);
+			result.i += n;
+			return result;
+		}
+
+		friend MayaArrayIter operator+(const difference_type& n, const MayaArrayIter& it) {
+			return it + n;
 		}
 
 		MayaArrayIter& operator+=(const difference_type& n)	{
@@ -152,7 +325,9 @@ public:
 		}
 
 		MayaArrayIter operator-(const difference_type& n) const	{
-			return MayaArrayIter(*c, (i - n));
+			MayaArrayIter result(*this);
+			result.i -= n;
+			return result;
 		}
 
 		MayaArrayIter& operator-=(const difference_type& n)	{
@@ -161,60 +336,161 @@ public:
 		}
 
 		reference operator[](const difference_type& n) const {
+			this->checkElement(c, i + n);
+			MAYAARRAY_COUNT(typename std::remove_const<C>::type, kCountDerefs, 1);
 			return (*c)[i + n];
 		}
 
-		bool operator==(const MayaArrayIter& other) const {
-			return (i == other.i && c == other.c);
+		template<typename C2, typename V2, typename R2>
+		bool operator==(const MayaArrayIter<C2, V2, R2>& other) const {
+			checkSame(other);
+			return i == other.i;
 		}
 
-		bool operator!=(const MayaArrayIter& other) const {
+		template<typename C2, typename V2, typename R2>
+		bool operator!=(const MayaArrayIter<C2, V2, R2>& other) const {
 			return !(*this == other);
 		}
 
-		bool operator<(const MayaArrayIter& other) const {
-			return (i < other.i && c == other.c);
+		template<typename C2, typename V2, typename R2>
+		bool operator<(const MayaArrayIter<C2, V2, R2>& other) const {
+			checkSame(other);
+			return i < other.i;
 		}
 
-		bool operator>(const MayaArrayIter& other) const {
-			return !(*this < other || *this == other);
+		template<typename C2, typename V2, typename R2>
+		bool operator>(const MayaArrayIter<C2, V2, R2>& other) const {
+			return other < *this;
 		}
 
-		bool operator<=(const MayaArrayIter& other) const {
-			return !(*this > other);
+		template<typename C2, typename V2, typename R2>
+		bool operator<=(const MayaArrayIter<C2, V2, R2>& other) const {
+			return !(other < *this);
 		}
 
-		bool operator>=(const MayaArrayIter& other) const {
+		template<typename C2, typename V2, typename R2>
+		bool operator>=(const MayaArrayIter<C2, V2, R2>& other) const {
 			return !(*this < other);
 		}
 
-		difference_type operator+(const MayaArrayIter& other) const	{
+		template<typename C2, typename V2, typename R2>
+		difference_type operator+(const MayaArrayIter<C2, V2, R2>& other) const	{
 			return i + other.i;
 		}
 
-		difference_type operator-(const MayaArrayIter& other) const	{
-			return i - other.i;
+		template<typename C2, typename V2, typename R2>
+		difference_type operator-(const MayaArrayIter<C2, V2, R2>& other) const	{
+			checkSame(other);
+			return static_cast<difference_type>(i) - static_cast<difference_type>(other.i);
 		}
 	};
 
-	typedef MayaArrayIter<T, item_type, ref_type> iterator;
-	typedef MayaArrayIter<const T, const item_type, const_ref_type> const_iterator;
+	// arrays with contiguous storage use raw pointers as their unchecked
+	// iterators so the standard library algorithms can take their memmove and
+	// vectorized paths. This does not change with MAYAARRAY_INSTRUMENTATION, so
+	// dereferences through these pointers are not counted.
+	typedef mayatemplates::is_contiguous_array<typename std::remove_const<T>::type> is_contiguous;
+	typedef std::integral_constant<bool, is_contiguous::value && !is_checked::value> uses_pointers;
+
+	typedef typename std::conditional<uses_pointers::value,
+		item_type*,
+		MayaArrayIter<T, item_type, ref_type> >::type iterator;
+	typedef typename std::conditional<uses_pointers::value,
+		const const_item_type*,
+		MayaArrayIter<const T, const const_item_type, const_ref_type> >::type const_iterator;
 	typedef std::reverse_iterator<iterator> reverse_iterator;
 	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 	
-	MayaArrayRange(T* mayaArray) : mArray(*mayaArray) {}
-	MayaArrayRange(T& mayaArray) : mArray(mayaArray) {}
+	MayaArrayRange(T* mayaArray) : mArray(*mayaArray), mFirst(0), mLast(kToEnd), mGrainSize(1) {}
+	MayaArrayRange(T& mayaArray) : mArray(mayaArray), mFirst(0), mLast(kToEnd), mGrainSize(1) {}
+
+	/**
+	Creates a range over the elements from index "first" up to, but not
+	including, index "last" of the array.
+
+	\param[in] mayaArray the Maya array
+	\param[in] first index of the first element in the range
+	\param[in] last index of one past the last element in the range
+	\param[in] grainSize the range is divisible while it has more elements than this
+	*/
+	MayaArrayRange(T& mayaArray, size_type first, size_type last, size_type grainSize=1)
+		: mArray(mayaArray), mFirst(first), mLast(last), mGrainSize(grainSize ? grainSize : 1) {
+		assert(first <= last && last <= mayaArray.length());
+	}
+
+	/**
+	Splitting constructor that takes the second half of the other range, leaving
+	the first half in the other range. The second argument is a tag such as
+	tbb::split, which makes the range usable with TBB's parallel algorithms.
+
+	\param[in,out] other the range to split
+	*/
+	template<typename Split, typename = typename std::enable_if<std::is_empty<Split>::value>::type>
+	MayaArrayRange(MayaArrayRange& other, Split)
+		: mArray(other.mArray), mFirst(other.middle()), mLast(other.endIndex()), mGrainSize(other.mGrainSize) {
+		other.mLast = mFirst;
+	}
+
+	/**
+	Splits the range in half, keeping the first half in this range.
+
+	\return
+	range with the second half of the elements
+	*/
+	MayaArrayRange split() {
+		size_type half = middle();
+		MayaArrayRange second(mArray, half, endIndex(), mGrainSize);
+		mLast = half;
+		return second;
+	}
+
+	/**
+	Returns true if the range has more elements than its grain size and can
+	be split.
+	*/
+	bool is_divisible() const {
+		return mGrainSize < size();
+	}
+
+	/**
+	Returns the grain size of the range
+	*/
+	size_type grainsize() const {
+		return mGrainSize;
+	}
+
+	/**
+	Returns the index in the array of the first element in the range
+	*/
+	size_type beginIndex() const {
+		return mFirst;
+	}
+
+	/**
+	Returns the index in the array of one past the last element in the range.
+	A range over the whole array follows the length of the array.
+	*/
+	size_type endIndex() const {
+		return mLast == kToEnd ? mArray.length() : mLast;
+	}
+
+	/**
+	Returns the Maya array of the range
+	*/
+	T& array() const {
+		return mArray;
+	}
 	
 	iterator begin() {
-		return iterator(mArray);
+		return iteratorAt(mArray, mFirst);
 	}
 
 	const_iterator begin() const {
-		return const_iterator(mArray);
+		return iteratorAt(static_cast<const T&>(mArray), mFirst);
 	}
 
 	const_iterator cbegin() const {
-		return const_iterator(mArray);
+		return iteratorAt(static_cast<const T&>(mArray), mFirst);
 	}
 
 	reverse_iterator rbegin() {
@@ -230,15 +506,15 @@ public:
 	}
 
 	iterator end() {
-		return iterator(mArray, mArray.length());
+		return iteratorAt(mArray, endIndex());
 	}
 
 	const_iterator end() const {
-		return const_iterator(mArray, mArray.length());
+		return iteratorAt(static_cast<const T&>(mArray), endIndex());
 	}
 
 	const_iterator cend() const {
-		return const_iterator(mArray, mArray.length());
+		return iteratorAt(static_cast<const T&>(mArray), endIndex());
 	}
 
 	reverse_iterator rend() {
@@ -253,8 +529,88 @@ public:
 		return const_reverse_iterator(cbegin());
 	}
 
+	/**
+	Returns a pointer to the first element of the array or null if the array
+	is empty. Only available for arrays with contiguous storage.
+	*/
+	item_type* data() {
+		static_assert(is_contiguous::value, "Maya array type does not have contiguous storage");
+		return dataOf(mArray) + mFirst;
+	}
+
+	/**
+	Returns a const pointer to the first element of the array or null if the
+	array is empty. Only available for arrays with contiguous storage.
+	*/
+	const const_item_type* data() const {
+		static_assert(is_contiguous::value, "Maya array type does not have contiguous storage");
+		return dataOf(static_cast<const T&>(mArray)) + mFirst;
+	}
+
+	/**
+	Returns the number of elements in the range
+	*/
+	size_type size() const {
+		return endIndex() - mFirst;
+	}
+
+	/**
+	Returns true if the range has no elements
+	*/
+	bool empty() const {
+		return size() == 0;
+	}
+
 protected:
+	// marks a range that ends at the current length of the array
+	static const size_type kToEnd = ~0u;
+
 	T& mArray;
+	size_type mFirst;
+	size_type mLast;
+	size_type mGrainSize;
+
+	size_type middle() const {
+		return mFirst + size() / 2;
+	}
+
+	// the overloads for mutable arrays take the array without const, so they do
+	// not collide with the const overloads when T is a const Maya array
+	typedef typename std::remove_const<T>::type mutable_array_type;
+
+	static item_type* dataOf(mutable_array_type& a) {
+		return a.length() ? &a[0] : nullptr;
+	}
+
+	static const const_item_type* dataOf(const T& a) {
+		return a.length() ? &a[0] : nullptr;
+	}
+
+	static iterator iteratorAt(mutable_array_type& a, size_type i, const unsigned int*, std::true_type) {
+		return dataOf(a) + i;
+	}
+
+	static const_iterator iteratorAt(const T& a, size_type i, const unsigned int*, std::true_type) {
+		return dataOf(a) + i;
+	}
+
+	static iterator iteratorAt(mutable_array_type& a, size_type i, const unsigned int* generation, std::false_type) {
+		return iterator(a, i, generation);
+	}
+
+	static const_iterator iteratorAt(const T& a, size_type i, const unsigned int* generation, std::false_type) {
+		return const_iterator(a, i, generation);
+	}
+
+	// creates the iterator type selected for T at the given index, checked
+	// iterators compare the generation with the source to find stale iterators
+	static iterator iteratorAt(mutable_array_type& a, size_type i, const unsigned int* generation=nullptr) {
+		return iteratorAt(a, i, generation, uses_pointers());
+	}
+
+	static const_iterator iteratorAt(const T& a, size_type i, const unsigned int* generation=nullptr) {
+		return iteratorAt(a, i, generation, uses_pointers());
+	}
 };
 
 } // namespace mayaiteration
@@ -0,0 +1,259 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef MAYAITERATION_MAYA_GEOMETRY_RANGE_H_
+#define MAYAITERATION_MAYA_GEOMETRY_RANGE_H_
+
+#include <maya/MFn.h>
+#include <maya/MFnSingleIndexedComponent.h>
+#include <maya/MIntArray.h>
+#include <maya/MItGeometry.h>
+#include <maya/MObject.h>
+#include <maya/MPointArray.h>
+#include <maya_array/maya_array.h>
+
+namespace mayaiteration {
+
+/**
+Maya Geometry Range Class
+
+DESCRIPTION:
+Wraps a MItGeometry so the points it iterates over can be used as a range. All
+positions are read with a single "allPositions" call when the range is created
+and written back with a single "setAllPositions" call, instead of calling
+"position", "setPosition" and "next" for every point. The component index of
+each point is available through "indices", which is only built when it is
+needed. When the range is created with the component the iterator was made
+from, the indices come straight from the component. Otherwise they are read by
+walking the iterator once.
+
+Changed positions are written back with "flush". Reading the points, through
+any of the accessors, never marks them as changed. Points changed with "set"
+are marked, and so are all points after "markModified". Marked points that
+were not flushed yet are written back when the range is destroyed, so call
+"markModified" after writing through the iterators, "[]" or "points" to rely
+on that.
+
+USAGE:
+	MStatus MyDeformer::deform(MDataBlock& data, MItGeometry& iter, const MMatrix& m, unsigned int multiIndex) {
+		mayaiteration::MayaGeometryRange points(iter);
+		const mayaarray::MayaArray<MIntArray>& indices = points.indices();
+		for (unsigned int i = 0; i < points.size(); ++i)
+			points[i] += offset * weightValue(data, multiIndex, indices[i]);
+		return points.flush();
+	}
+
+	// reading only, nothing is written back
+	MBoundingBox box;
+	for (auto it = points.cbegin(); it != points.cend(); ++it)
+		box.expand(*it);
+*/
+class MayaGeometryRange {
+public:
+	typedef mayaarray::MayaArray<MPointArray>::iterator iterator;
+	typedef mayaarray::MayaArray<MPointArray>::const_iterator const_iterator;
+	typedef mayaarray::MayaArray<MPointArray>::size_type size_type;
+
+	/**
+	Reads all positions of the geometry iterator
+
+	\param[in] iter the geometry iterator
+	\param[in] space the space the positions are read and written in
+	*/
+	MayaGeometryRange(MItGeometry& iter, MSpace::Space space=MSpace::kObject)
+		: mIter(iter), mSpace(space), mModified(false), mIndicesLoaded(false) {
+		mIter.allPositions(mPoints.array(), mSpace);
+	}
+
+	/**
+	Reads all positions of a geometry iterator that was created for the
+	component, which lets the indices be read from the component directly.
+
+	\param[in] iter the geometry iterator
+	\param[in] component the component the iterator was created for
+	\param[in] space the space the positions are read and written in
+	*/
+	MayaGeometryRange(MItGeometry& iter, const MObject& component, MSpace::Space space=MSpace::kObject)
+		: mIter(iter), mComponent(component), mSpace(space), mModified(false), mIndicesLoaded(false) {
+		mIter.allPositions(mPoints.array(), mSpace);
+	}
+
+	/**
+	Takes over the points of another range, which no longer writes them back
+	*/
+	MayaGeometryRange(MayaGeometryRange&& other)
+		: mIter(other.mIter), mComponent(other.mComponent), mSpace(other.mSpace),
+		  mPoints(std::move(other.mPoints)), mIndices(std::move(other.mIndices)),
+		  mModified(other.mModified), mIndicesLoaded(other.mIndicesLoaded) {
+		other.mModified = false;
+	}
+
+	// copies would write the same points back more than once
+	MayaGeometryRange(const MayaGeometryRange&) = delete;
+	MayaGeometryRange& operator=(const MayaGeometryRange&) = delete;
+
+	/**
+	Writes the positions back if they were changed and not flushed yet
+	*/
+	~MayaGeometryRange() {
+		if (mModified)
+			flush();
+	}
+
+	/**
+	Writes all positions back to the geometry iterator with a single call
+
+	\return
+	status of setting the positions
+	*/
+	MStatus flush() {
+		mModified = false;
+		return mIter.setAllPositions(mPoints.array(), mSpace);
+	}
+
+	/**
+	Marks the points as changed, so they are written back when the range is
+	destroyed if they are not flushed before
+	*/
+	void markModified() {
+		mModified = true;
+	}
+
+	/**
+	Returns true if the points are marked as changed and not flushed yet
+	*/
+	bool modified() const {
+		return mModified;
+	}
+
+	/**
+	Returns the cached points, writing through them does not mark them as modified
+	*/
+	mayaarray::MayaArray<MPointArray>& points() {
+		return mPoints;
+	}
+
+	const mayaarray::MayaArray<MPointArray>& points() const {
+		return mPoints;
+	}
+
+	iterator begin() {
+		return mPoints.begin();
+	}
+
+	const_iterator begin() const {
+		return mPoints.begin();
+	}
+
+	const_iterator cbegin() const {
+		return mPoints.cbegin();
+	}
+
+	iterator end() {
+		return mPoints.end();
+	}
+
+	const_iterator end() const {
+		return mPoints.end();
+	}
+
+	const_iterator cend() const {
+		return mPoints.cend();
+	}
+
+	MPoint& operator[](size_type pos) {
+		return mPoints[pos];
+	}
+
+	const MPoint& operator[](size_type pos) const {
+		return mPoints[pos];
+	}
+
+	/**
+	Sets the position of a point and marks the points as modified
+
+	\param[in] pos position in the range
+	\param[in] point the new position
+	*/
+	void set(size_type pos, const MPoint& point) {
+		mPoints[pos] = point;
+		mModified = true;
+	}
+
+	/**
+	Returns the number of points
+	*/
+	size_type size() const {
+		return mPoints.size();
+	}
+
+	/**
+	Returns the component index of each point, in the same order as the points.
+	They are built the first time this is called.
+	*/
+	const mayaarray::MayaArray<MIntArray>& indices() {
+		if (!mIndicesLoaded) {
+			loadIndices();
+			mIndicesLoaded = true;
+		}
+		return mIndices;
+	}
+
+protected:
+	MItGeometry& mIter;
+	MObject mComponent;
+	MSpace::Space mSpace;
+	mayaarray::MayaArray<MPointArray> mPoints;
+	mayaarray::MayaArray<MIntArray> mIndices;
+	bool mModified;
+	bool mIndicesLoaded;
+
+	void loadIndices() {
+		if (!mComponent.isNull() && mComponent.hasFn(MFn::kSingleIndexedComponent)) {
+			MFnSingleIndexedComponent componentFn(mComponent);
+			if (componentFn.isComplete()) {
+				// a complete component covers every point in order
+				mIndices.resize(size());
+				for (size_type i = 0; i < size(); ++i)
+					mIndices[i] = static_cast<int>(i);
+			}
+			else {
+				componentFn.getElements(mIndices.array());
+			}
+			if (mIndices.size() == size())
+				return;
+		}
+
+		// walk the iterator once when the indices can not be read in bulk
+		mIndices.clear();
+		mIndices.reserve(size());
+		for (mIter.reset(); !mIter.isDone(); mIter.next())
+			mIndices.push_back(mIter.index());
+		mIter.reset();
+	}
+};
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_GEOMETRY_RANGE_H_
@@ -0,0 +1,208 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAITERATION_MAYA_PARALLEL_H_
+#define MAYAITERATION_MAYA_PARALLEL_H_
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+// arrays with fewer elements than this are processed with a serial loop,
+// it can be defined before including this header to change it
+#ifndef MAYAITERATION_PARALLEL_SERIAL_THRESHOLD
+#define MAYAITERATION_PARALLEL_SERIAL_THRESHOLD 2048
+#endif
+
+namespace mayaiteration {
+
+/*
+Default number of elements each task processes
+*/
+const unsigned int kDefaultGrainSize = 1024;
+
+/**
+Calls the function on every element of the range in parallel using the TBB
+scheduler. The range is split by index into chunks of about "grainSize"
+elements. Ranges smaller than MAYAITERATION_PARALLEL_SERIAL_THRESHOLD are
+processed with a serial loop.
+
+USAGE:
+	mayaarray::MayaArray<MPointArray> points;
+	mayaiteration::parallel_for_each(points, [&](MPoint& pnt) {
+		pnt *= matrix;
+	});
+
+\param[in,out] range a MayaArray, MayaArrayRange or other random access range
+\param[in] func function called with each element
+\param[in] grainSize number of elements processed by each task, 0 is treated as 1
+*/
+template<typename Range, typename Func>
+void parallel_for_each(Range&& range, Func func, unsigned int grainSize=kDefaultGrainSize) {
+	auto first = range.begin();
+	const unsigned int count = static_cast<unsigned int>(range.end() - first);
+	if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD || count <= grainSize) {
+		for (unsigned int i = 0; i < count; ++i)
+			func(first[i]);
+		return;
+	}
+	tbb::parallel_for(tbb::blocked_range<unsigned int>(0, count, std::max(grainSize, 1u)),
+		[&](const tbb::blocked_range<unsigned int>& chunk) {
+			auto it = first + chunk.begin();
+			for (unsigned int i = chunk.begin(); i != chunk.end(); ++i, ++it)
+				func(*it);
+		});
+}
+
+/**
+Stores the result of applying the operation to every element of the input
+range in the output range, in parallel. The output range must already have
+the same size as the input and may be the same range.
+
+USAGE:
+	mayaarray::MayaArray<MDoubleArray> lengths(vectors.size());
+	mayaiteration::parallel_transform(vectors, lengths, [](const MVector& v) {
+		return v.length();
+	});
+
+\param[in] in a MayaArray, MayaArrayRange or other random access range
+\param[out] out range the results are stored to
+\param[in] op unary operation
+\param[in] grainSize number of elements processed by each task, 0 is treated as 1
+*/
+template<typename InRange, typename OutRange, typename UnaryOp>
+void parallel_transform(const InRange& in, OutRange&& out, UnaryOp op, unsigned int grainSize=kDefaultGrainSize) {
+	auto first = in.begin();
+	auto result = out.begin();
+	const unsigned int count = static_cast<unsigned int>(in.end() - first);
+	assert(static_cast<unsigned int>(out.end() - result) == count);
+	if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD || count <= grainSize) {
+		for (unsigned int i = 0; i < count; ++i)
+			result[i] = op(first[i]);
+		return;
+	}
+	tbb::parallel_for(tbb::blocked_range<unsigned int>(0, count, std::max(grainSize, 1u)),
+		[&](const tbb::blocked_range<unsigned int>& chunk) {
+			for (unsigned int i = chunk.begin(); i != chunk.end(); ++i)
+				result[i] = op(first[i]);
+		});
+}
+
+/**
+Stores the result of applying the operation to each pair of elements from two
+input ranges in the output range, in parallel. All ranges must have the same
+size and the output may be one of the inputs.
+
+\param[in] in1 first input range
+\param[in] in2 second input range
+\param[out] out range the results are stored to
+\param[in] op binary operation
+\param[in] grainSize number of elements processed by each task, 0 is treated as 1
+*/
+template<typename InRange1, typename InRange2, typename OutRange, typename BinaryOp,
+	typename = typename std::enable_if<!std::is_integral<BinaryOp>::value>::type>
+void parallel_transform(const InRange1& in1, const InRange2& in2, OutRange&& out, BinaryOp op, unsigned int grainSize=kDefaultGrainSize) {
+	auto first1 = in1.begin();
+	auto first2 = in2.begin();
+	auto result = out.begin();
+	const unsigned int count = static_cast<unsigned int>(in1.end() - first1);
+	assert(static_cast<unsigned int>(in2.end() - first2) == count);
+	assert(static_cast<unsigned int>(out.end() - result) == count);
+	if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD || count <= grainSize) {
+		for (unsigned int i = 0; i < count; ++i)
+			result[i] = op(first1[i], first2[i]);
+		return;
+	}
+	tbb::parallel_for(tbb::blocked_range<unsigned int>(0, count, std::max(grainSize, 1u)),
+		[&](const tbb::blocked_range<unsigned int>& chunk) {
+			for (unsigned int i = chunk.begin(); i != chunk.end(); ++i)
+				result[i] = op(first1[i], first2[i]);
+		});
+}
+
+/**
+Reduces all elements of the range to a single value in parallel. Each task
+starts from "identity" and folds its elements in with "accumulate", then the
+partial results are merged with "combine". The order elements and partial
+results are combined in is not fixed, so the operations should be associative.
+
+USAGE:
+	MBoundingBox bounds = mayaiteration::parallel_reduce(points, MBoundingBox(),
+		[](MBoundingBox box, const MPoint& pnt) { box.expand(pnt); return box; },
+		[](MBoundingBox a, const MBoundingBox& b) { a.expand(b); return a; });
+
+\param[in] range a MayaArray, MayaArrayRange or other random access range
+\param[in] identity the starting value of each task
+\param[in] accumulate function taking a value and an element and returning the new value
+\param[in] combine function taking two values and returning the merged value
+\param[in] grainSize number of elements processed by each task, 0 is treated as 1
+
+\return
+the reduced value
+*/
+template<typename Range, typename Value, typename Accumulate, typename Combine,
+	typename = typename std::enable_if<!std::is_integral<Combine>::value>::type>
+Value parallel_reduce(const Range& range, const Value& identity, Accumulate accumulate, Combine combine, unsigned int grainSize=kDefaultGrainSize) {
+	auto first = range.begin();
+	const unsigned int count = static_cast<unsigned int>(range.end() - first);
+	if (count < MAYAITERATION_PARALLEL_SERIAL_THRESHOLD || count <= grainSize) {
+		Value value = identity;
+		for (unsigned int i = 0; i < count; ++i)
+			value = accumulate(value, first[i]);
+		return value;
+	}
+	return tbb::parallel_reduce(tbb::blocked_range<unsigned int>(0, count, std::max(grainSize, 1u)), identity,
+		[&](const tbb::blocked_range<unsigned int>& chunk, Value value) {
+			for (unsigned int i = chunk.begin(); i != chunk.end(); ++i)
+				value = accumulate(value, first[i]);
+			return value;
+		},
+		[&](const Value& a, const Value& b) {
+			return combine(a, b);
+		});
+}
+
+/**
+Reduces all elements of the range to a single value in parallel, using the
+same operation to fold in elements and to merge partial results, such as
+std::plus for a sum.
+
+\param[in] range a MayaArray, MayaArrayRange or other random access range
+\param[in] identity the starting value of each task
+\param[in] op associative function taking two values and returning the result
+\param[in] grainSize number of elements processed by each task, 0 is treated as 1
+
+\return
+the reduced value
+*/
+template<typename Range, typename Value, typename BinaryOp>
+Value parallel_reduce(const Range& range, const Value& identity, BinaryOp op, unsigned int grainSize=kDefaultGrainSize) {
+	return parallel_reduce(range, identity, op, op, grainSize);
+}
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_PARALLEL_H_
@@ -0,0 +1,320 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAITERATION_MAYA_PLUG_IO_H_
+#define MAYAITERATION_MAYA_PLUG_IO_H_
+
+#include <maya/MArrayDataBuilder.h>
+#include <maya/MArrayDataHandle.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDGModifier.h>
+#include <maya/MFnMatrixData.h>
+#include <maya/MFnNumericData.h>
+#include <maya/MIntArray.h>
+#include <maya/MMatrix.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MStatus.h>
+#include <maya/MVector.h>
+#include <maya_array/maya_array.h>
+#include <maya_iteration/maya_array_data_range.h>
+
+namespace mayaiteration {
+
+// reads and writes values of plugs, for the types used by the helpers below.
+// Matrices and vectors are read through their data objects, which is a single
+// call instead of one per child plug.
+
+inline MStatus getPlugValue(const MPlug& plug, double& value) {
+	MStatus status;
+	value = plug.asDouble(&status);
+	return status;
+}
+
+inline MStatus getPlugValue(const MPlug& plug, float& value) {
+	MStatus status;
+	value = plug.asFloat(&status);
+	return status;
+}
+
+inline MStatus getPlugValue(const MPlug& plug, int& value) {
+	MStatus status;
+	value = plug.asInt(&status);
+	return status;
+}
+
+inline MStatus getPlugValue(const MPlug& plug, bool& value) {
+	MStatus status;
+	value = plug.asBool(&status);
+	return status;
+}
+
+inline MStatus getPlugValue(const MPlug& plug, MMatrix& value) {
+	MStatus status;
+	MObject data = plug.asMObject(&status);
+	if (!status)
+		return status;
+	MFnMatrixData matrixData(data, &status);
+	if (status)
+		value = matrixData.matrix();
+	return status;
+}
+
+inline MStatus getPlugValue(const MPlug& plug, MVector& value) {
+	MStatus status;
+	MObject data = plug.asMObject(&status);
+	if (!status)
+		return status;
+	MFnNumericData numericData(data, &status);
+	if (status)
+		status = numericData.getData(value.x, value.y, value.z);
+	return status;
+}
+
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, double value) { return modifier.newPlugValueDouble(plug, value); }
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, float value) { return modifier.newPlugValueFloat(plug, value); }
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, int value) { return modifier.newPlugValueInt(plug, value); }
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, bool value) { return modifier.newPlugValueBool(plug, value); }
+
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, const MMatrix& value) {
+	MStatus status;
+	MFnMatrixData matrixData;
+	MObject data = matrixData.create(value, &status);
+	return status ? modifier.newPlugValue(plug, data) : status;
+}
+
+inline MStatus setPlugValue(MDGModifier& modifier, const MPlug& plug, const MVector& value) {
+	MStatus status;
+	MFnNumericData numericData;
+	MObject data = numericData.create(MFnNumericData::k3Double, &status);
+	if (status)
+		status = numericData.setData(value.x, value.y, value.z);
+	return status ? modifier.newPlugValue(plug, data) : status;
+}
+
+/**
+Reads the value of every plug of the array, such as the same attribute of many
+nodes. The values are sized once before they are filled.
+
+\param[in] plugs the plugs to read
+\param[out] values array for the values, such as a MayaArray<MDoubleArray> or MayaArray<MMatrixArray>
+
+\return
+status of the first plug that could not be read
+*/
+template<typename T, typename P>
+MStatus readPlugs(const MPlugArray& plugs, mayaarray::MayaArray<T, P>& values) {
+	values.resize(plugs.length());
+	for (unsigned int i = 0; i < plugs.length(); ++i) {
+		MStatus status = getPlugValue(plugs[i], values[i]);
+		if (!status)
+			return status;
+	}
+	return MS::kSuccess;
+}
+
+/**
+Reads the values of all existing elements of an array plug in element order,
+optionally with their logical indices. The whole array is read through one
+data handle of the plug, with the same element walk as "readElements" for a
+MArrayDataHandle. If the plug has no data handle the elements are read one
+plug at a time.
+
+\param[in] arrayPlug the array plug
+\param[out] values array for the element values
+\param[out] indices optional array for the logical indices of the elements, which may use a
+different iterator policy than the values
+
+\return
+status of reading the elements
+*/
+template<typename T, typename P, typename PI=P>
+MStatus readElements(const MPlug& arrayPlug, mayaarray::MayaArray<T, P>& values, mayaarray::MayaArray<MIntArray, PI>* indices=nullptr) {
+	MStatus status;
+	MDataHandle handle = arrayPlug.asMDataHandle(&status);
+	if (status) {
+		MArrayDataHandle arrayHandle(handle, &status);
+		if (status)
+			readElements(arrayHandle, values, indices);
+		arrayPlug.destructHandle(handle);
+		if (status)
+			return status;
+	}
+
+	MIntArray existing;
+	arrayPlug.getExistingArrayAttributeIndices(existing, &status);
+	if (!status)
+		return status;
+	values.resize(existing.length());
+	if (indices)
+		indices->resize(existing.length());
+	for (unsigned int i = 0; i < existing.length(); ++i) {
+		status = getPlugValue(arrayPlug.elementByLogicalIndex(static_cast<unsigned int>(existing[i])), values[i]);
+		if (!status)
+			return status;
+		if (indices)
+			(*indices)[i] = existing[i];
+	}
+	return MS::kSuccess;
+}
+
+/**
+Reads the elements of an array plug with logical indices from "first" up to
+but not including "first + count" into a dense array, where element
+"first + i" is stored at position i. Elements that do not exist get the
+default value. Like "readElements", the array is read through one data handle
+when the plug has one.
+
+\param[in] arrayPlug the array plug
+\param[in] first logical index of the first element
+\param[in] count number of elements
+\param[out] values array that is resized to "count" elements
+\param[in] defaultValue value of elements that do not exist
+
+\return
+status of reading the elements
+*/
+template<typename T, typename P, typename V>
+MStatus readRange(const MPlug& arrayPlug, unsigned int first, unsigned int count, mayaarray::MayaArray<T, P>& values, const V& defaultValue) {
+	values.assign(count, defaultValue);
+	MStatus status;
+	MDataHandle handle = arrayPlug.asMDataHandle(&status);
+	if (status) {
+		MArrayDataHandle arrayHandle(handle, &status);
+		if (status) {
+			MayaArrayDataRange range(arrayHandle);
+			for (MayaArrayDataRange::iterator it = range.begin(); it != range.end(); ++it) {
+				if (first <= it->index && it->index - first < count)
+					getDataValue(it->data, values[it->index - first]);
+			}
+		}
+		arrayPlug.destructHandle(handle);
+		if (status)
+			return status;
+	}
+
+	MIntArray existing;
+	arrayPlug.getExistingArrayAttributeIndices(existing, &status);
+	if (!status)
+		return status;
+	for (unsigned int i = 0; i < existing.length(); ++i) {
+		const unsigned int index = static_cast<unsigned int>(existing[i]);
+		if (first <= index && index - first < count) {
+			status = getPlugValue(arrayPlug.elementByLogicalIndex(index), values[index - first]);
+			if (!status)
+				return status;
+		}
+	}
+	return MS::kSuccess;
+}
+
+/**
+Adds an undoable change of every plug of the array to the modifier, one value
+per plug. Nothing changes until "doIt" is called on the modifier, and the
+whole batch is undone as one step.
+
+\param[in] plugs the plugs to write
+\param[in] values one value for each plug
+\param[in] modifier the modifier the changes are added to
+
+\return
+status of the first change that could not be added
+*/
+template<typename T, typename P>
+MStatus writePlugs(const MPlugArray& plugs, const mayaarray::MayaArray<T, P>& values, MDGModifier& modifier) {
+	if (plugs.length() != values.size())
+		return MS::kInvalidParameter;
+	for (unsigned int i = 0; i < plugs.length(); ++i) {
+		MStatus status = setPlugValue(modifier, plugs[i], values[i]);
+		if (!status)
+			return status;
+	}
+	return MS::kSuccess;
+}
+
+/**
+Adds an undoable change of the elements of an array plug to the modifier,
+writing the values to the logical indices "first" to "first + values.size()".
+Nothing changes until "doIt" is called on the modifier.
+
+\param[in] arrayPlug the array plug
+\param[in] values the element values
+\param[in] modifier the modifier the changes are added to
+\param[in] first logical index of the first value
+
+\return
+status of the first change that could not be added
+*/
+template<typename T, typename P>
+MStatus writeElements(const MPlug& arrayPlug, const mayaarray::MayaArray<T, P>& values, MDGModifier& modifier, unsigned int first=0) {
+	for (unsigned int i = 0; i < values.size(); ++i) {
+		MStatus status;
+		MPlug element = arrayPlug.elementByLogicalIndex(first + i, &status);
+		if (status)
+			status = setPlugValue(modifier, element, values[i]);
+		if (!status)
+			return status;
+	}
+	return MS::kSuccess;
+}
+
+/**
+Sets the elements of an array plug at the logical indices "first" to
+"first + values.size()" through one data handle of the plug, adding elements
+that do not exist. This is much faster than "writeElements" for large arrays,
+such as baking weights, but the change is not undoable and is meant for tools
+that manage their own undo or for attributes that are not keyable.
+
+\param[in] arrayPlug the array plug
+\param[in] values the element values
+\param[in] first logical index of the first value
+
+\return
+status of setting the data handle, MS::kFailure if the plug has no data handle
+*/
+template<typename T, typename P>
+MStatus setElements(const MPlug& arrayPlug, const mayaarray::MayaArray<T, P>& values, unsigned int first=0) {
+	MStatus status;
+	MDataHandle handle = arrayPlug.asMDataHandle(&status);
+	if (!status)
+		return status;
+	MArrayDataHandle arrayHandle(handle, &status);
+	if (status) {
+		MayaArrayDataOutput output(arrayHandle, values.size());
+		for (unsigned int i = 0; i < values.size(); ++i) {
+			MDataHandle data = output.add(first + i);
+			setDataValue(data, values[i]);
+		}
+		status = output.commit();
+		if (status) {
+			MPlug plug(arrayPlug);
+			status = plug.setMDataHandle(handle);
+		}
+	}
+	arrayPlug.destructHandle(handle);
+	return status;
+}
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_PLUG_IO_H_
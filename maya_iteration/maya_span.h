@@ -0,0 +1,284 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef MAYAITERATION_MAYA_SPAN_H_
+#define MAYAITERATION_MAYA_SPAN_H_
+
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <maya/MFloatVector.h>
+#include <maya/MFnMesh.h>
+
+namespace mayaiteration {
+
+/**
+Maya Span Class Template
+
+DESCRIPTION:
+A non-owning view over a pointer and a number of elements, with the same
+iterator and range interface as MayaArrayRange. Some of Maya's fastest APIs
+return raw pointers instead of M***Array objects, such as MFnMesh::getRawPoints
+or MVertexBuffer::acquire. Wrapping those pointers in a MayaSpan lets them be
+used with the same algorithms as Maya arrays without copying the data into an
+array first. A MayaSpan can also be created from any contiguous range such as a
+MayaArray or MayaArrayRange. The memory must stay valid while the span is used.
+
+Like MayaArrayRange, a span can be split in half and has a grain size so it can
+be used with TBB's parallel algorithms.
+
+USAGE:
+	// view the raw vertex positions of a mesh as float vectors, without copying
+	mayaiteration::MayaSpan<const MFloatVector> points = mayaiteration::rawPoints(meshFn);
+	for (const MFloatVector& pnt : points)
+		std::cout << pnt.x << std::endl;
+
+	// view an acquired vertex buffer as floats
+	float* buffer = static_cast<float*>(vertexBuffer->acquire(vertexCount, true));
+	mayaiteration::MayaSpan<float> values(buffer, vertexCount * 3);
+	std::fill(values.begin(), values.end(), 0.0f);
+*/
+template<typename T>
+class MayaSpan {
+public:
+	typedef T element_type;
+	typedef typename std::remove_const<T>::type value_type;
+	typedef unsigned int size_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/**
+	Creates an empty span
+	*/
+	MayaSpan() : mData(nullptr), mSize(0), mGrainSize(1) {}
+
+	/**
+	Creates a span over "count" elements starting at the pointer
+
+	\param[in] data pointer to the first element
+	\param[in] count number of elements
+	\param[in] grainSize the span is divisible while it has more elements than this
+	*/
+	MayaSpan(T* data, size_type count, size_type grainSize=1)
+		: mData(data), mSize(count), mGrainSize(grainSize ? grainSize : 1) {}
+
+	/**
+	Creates a span over a contiguous range that has "data()" and "size()",
+	such as a MayaArray or MayaArrayRange
+
+	\param[in] range the contiguous range
+	*/
+	template<typename Range, typename = typename std::enable_if<
+		std::is_convertible<decltype(std::declval<Range&>().data()), T*>::value &&
+		!std::is_same<typename std::decay<Range>::type, MayaSpan>::value>::type>
+	MayaSpan(Range& range) : mData(range.data()), mSize(range.size()), mGrainSize(1) {}
+
+	/**
+	Creates a span over the same elements as a span of non-const elements
+	*/
+	template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+	MayaSpan(const MayaSpan<U>& other) : mData(other.data()), mSize(other.size()), mGrainSize(other.grainsize()) {}
+
+	/**
+	Splitting constructor that takes the second half of the other span, leaving
+	the first half in the other span. The second argument is a tag such as
+	tbb::split.
+
+	\param[in,out] other the span to split
+	*/
+	template<typename Split, typename = typename std::enable_if<std::is_empty<Split>::value>::type>
+	MayaSpan(MayaSpan& other, Split)
+		: mData(other.mData + other.mSize / 2), mSize(other.mSize - other.mSize / 2), mGrainSize(other.mGrainSize) {
+		other.mSize /= 2;
+	}
+
+	iterator begin() const {
+		return mData;
+	}
+
+	const_iterator cbegin() const {
+		return mData;
+	}
+
+	iterator end() const {
+		return mData + mSize;
+	}
+
+	const_iterator cend() const {
+		return mData + mSize;
+	}
+
+	reverse_iterator rbegin() const {
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator crbegin() const {
+		return const_reverse_iterator(cend());
+	}
+
+	reverse_iterator rend() const {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator crend() const {
+		return const_reverse_iterator(cbegin());
+	}
+
+	/**
+	Returns the pointer to the first element
+	*/
+	T* data() const {
+		return mData;
+	}
+
+	/**
+	Returns the number of elements in the span
+	*/
+	size_type size() const {
+		return mSize;
+	}
+
+	/**
+	Returns true if the span has no elements
+	*/
+	bool empty() const {
+		return mSize == 0;
+	}
+
+	reference operator[](size_type pos) const {
+		assert(pos < mSize);
+		return mData[pos];
+	}
+
+	reference front() const {
+		assert(mSize);
+		return mData[0];
+	}
+
+	reference back() const {
+		assert(mSize);
+		return mData[mSize - 1];
+	}
+
+	/**
+	Returns a span over "count" elements starting at "offset" in this span
+
+	\param[in] offset index of the first element
+	\param[in] count number of elements
+
+	\return
+	the sub span
+	*/
+	MayaSpan subspan(size_type offset, size_type count) const {
+		assert(offset <= mSize && count <= mSize - offset);
+		return MayaSpan(mData + offset, count, mGrainSize);
+	}
+
+	/**
+	Splits the span in half, keeping the first half in this span.
+
+	\return
+	span with the second half of the elements
+	*/
+	MayaSpan split() {
+		MayaSpan second(*this, Splitter());
+		return second;
+	}
+
+	/**
+	Returns true if the span has more elements than its grain size and can be split
+	*/
+	bool is_divisible() const {
+		return mGrainSize < mSize;
+	}
+
+	/**
+	Returns the grain size of the span
+	*/
+	size_type grainsize() const {
+		return mGrainSize;
+	}
+
+protected:
+	struct Splitter {};
+
+	T* mData;
+	size_type mSize;
+	size_type mGrainSize;
+};
+
+/**
+Creates a span over "count" elements starting at the pointer
+
+\param[in] data pointer to the first element
+\param[in] count number of elements
+
+\return
+the span
+*/
+template<typename T>
+inline MayaSpan<T> make_span(T* data, unsigned int count) {
+	return MayaSpan<T>(data, count);
+}
+
+/**
+Creates a span over the raw vertex positions of a mesh, as returned by
+MFnMesh::getRawPoints. The span is valid until the mesh is changed.
+
+\param[in] meshFn function set attached to the mesh
+\param[out] status optional return status
+
+\return
+span of the vertex positions
+*/
+inline MayaSpan<const MFloatVector> rawPoints(MFnMesh& meshFn, MStatus* status=nullptr) {
+	static_assert(sizeof(MFloatVector) == 3 * sizeof(float), "MFloatVector is expected to be three floats");
+	const float* points = meshFn.getRawPoints(status);
+	return MayaSpan<const MFloatVector>(reinterpret_cast<const MFloatVector*>(points), points ? meshFn.numVertices() : 0);
+}
+
+/**
+Creates a span over the raw normals of a mesh, as returned by
+MFnMesh::getRawNormals. The span is valid until the mesh is changed.
+
+\param[in] meshFn function set attached to the mesh
+\param[out] status optional return status
+
+\return
+span of the normals
+*/
+inline MayaSpan<const MFloatVector> rawNormals(MFnMesh& meshFn, MStatus* status=nullptr) {
+	static_assert(sizeof(MFloatVector) == 3 * sizeof(float), "MFloatVector is expected to be three floats");
+	const float* normals = meshFn.getRawNormals(status);
+	return MayaSpan<const MFloatVector>(reinterpret_cast<const MFloatVector*>(normals), normals ? meshFn.numNormals() : 0);
+}
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_SPAN_H_
@@ -0,0 +1,912 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYAITERATION_MAYA_VIEWS_H_
+#define MAYAITERATION_MAYA_VIEWS_H_
+
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+#include <maya_array/maya_array.h>
+
+namespace mayaiteration {
+
+/*
+An element of an enumerated view, with the index of the element and a
+reference to it
+*/
+template<typename R>
+struct MayaIndexedElement {
+	unsigned int index;
+	R value;
+};
+
+namespace detail {
+
+// views are C++20 views when the standard ranges library is available
+#if defined(__cpp_lib_ranges)
+struct ViewBase : std::ranges::view_base {};
+#else
+struct ViewBase {};
+#endif
+
+// refers to a range that was passed to a view as an lvalue
+template<typename R>
+class RangeRef {
+public:
+	typedef R range_type;
+
+	explicit RangeRef(R& range) : mRange(&range) {}
+
+	R& get() const {
+		return *mRange;
+	}
+
+protected:
+	R* mRange;
+};
+
+// keeps a range that was passed to a view as an rvalue, such as another view
+template<typename R>
+class RangeOwn {
+public:
+	typedef R range_type;
+
+	explicit RangeOwn(R&& range) : mRange(std::move(range)) {}
+
+	R& get() const {
+		return mRange;
+	}
+
+protected:
+	mutable R mRange;
+};
+
+template<typename R>
+struct range_holder {
+	typedef typename std::conditional<std::is_lvalue_reference<R>::value,
+		RangeRef<typename std::remove_reference<R>::type>,
+		RangeOwn<typename std::remove_reference<R>::type> >::type type;
+};
+
+// holds a function object and can be assigned even when the function object
+// can not, such as a lambda, so the views stay assignable
+template<typename F>
+class FunctionBox {
+public:
+	explicit FunctionBox(const F& func) {
+		::new (static_cast<void*>(mStorage)) F(func);
+	}
+
+	FunctionBox(const FunctionBox& other) {
+		::new (static_cast<void*>(mStorage)) F(other.get());
+	}
+
+	FunctionBox& operator=(const FunctionBox& other) {
+		if (this != &other) {
+			get().~F();
+			::new (static_cast<void*>(mStorage)) F(other.get());
+		}
+		return *this;
+	}
+
+	~FunctionBox() {
+		get().~F();
+	}
+
+	const F& get() const {
+		return *reinterpret_cast<const F*>(mStorage);
+	}
+
+protected:
+	alignas(F) unsigned char mStorage[sizeof(F)];
+
+	F& get() {
+		return *reinterpret_cast<F*>(mStorage);
+	}
+};
+
+template<typename R>
+struct range_iterator {
+	typedef decltype(std::declval<R&>().begin()) type;
+};
+
+template<typename V>
+struct has_size {
+	template<typename U>
+	static auto test(int) -> decltype(std::declval<U&>().size(), std::true_type());
+	template<typename U>
+	static std::false_type test(...);
+	typedef decltype(test<V>(0)) type;
+};
+
+} // namespace detail
+
+/**
+Transform View Class Template
+
+DESCRIPTION:
+A view of a range where each element is the result of calling the function on
+the element of the range. The function is called every time an element is
+dereferenced, nothing is stored. Created with "mayaiteration::transform".
+*/
+template<typename R, typename F>
+class TransformView : public detail::ViewBase {
+	typedef typename detail::range_holder<R>::type holder_type;
+	typedef typename detail::range_iterator<typename holder_type::range_type>::type base_iterator;
+
+public:
+	typedef unsigned int size_type;
+
+	class iterator {
+	public:
+		typedef typename std::iterator_traits<base_iterator>::iterator_category iterator_category;
+		typedef iterator_category iterator_concept;
+		typedef decltype(std::declval<const F&>()(*std::declval<base_iterator&>())) reference;
+		typedef typename std::decay<reference>::type value_type;
+		typedef int difference_type;
+		typedef void pointer;
+
+		iterator() : mFunc(nullptr) {}
+		iterator(base_iterator it, const F* func) : mIt(it), mFunc(func) {}
+
+		reference operator*() const {
+			return (*mFunc)(*mIt);
+		}
+
+		reference operator[](difference_type n) const {
+			return (*mFunc)(*(mIt + n));
+		}
+
+		iterator& operator++() {
+			++mIt;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++mIt;
+			return previous;
+		}
+
+		iterator& operator--() {
+			--mIt;
+			return *this;
+		}
+
+		iterator operator--(int) {
+			iterator previous(*this);
+			--mIt;
+			return previous;
+		}
+
+		iterator& operator+=(difference_type n) {
+			mIt += n;
+			return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+			mIt -= n;
+			return *this;
+		}
+
+		iterator operator+(difference_type n) const {
+			return iterator(mIt + n, mFunc);
+		}
+
+		friend iterator operator+(difference_type n, const iterator& it) {
+			return it + n;
+		}
+
+		iterator operator-(difference_type n) const {
+			return iterator(mIt - n, mFunc);
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return static_cast<difference_type>(mIt - other.mIt);
+		}
+
+		bool operator==(const iterator& other) const { return mIt == other.mIt; }
+		bool operator!=(const iterator& other) const { return !(mIt == other.mIt); }
+		bool operator<(const iterator& other) const { return mIt < other.mIt; }
+		bool operator>(const iterator& other) const { return other.mIt < mIt; }
+		bool operator<=(const iterator& other) const { return !(other.mIt < mIt); }
+		bool operator>=(const iterator& other) const { return !(mIt < other.mIt); }
+
+	protected:
+		base_iterator mIt;
+		const F* mFunc;
+	};
+
+	typedef iterator const_iterator;
+
+	TransformView(holder_type base, const F& func) : mBase(std::move(base)), mFunc(func) {}
+
+	iterator begin() const {
+		return iterator(mBase.get().begin(), &mFunc.get());
+	}
+
+	iterator end() const {
+		return iterator(mBase.get().end(), &mFunc.get());
+	}
+
+	// only available when the range has a size
+	template<typename H=holder_type>
+	auto size() const -> decltype(static_cast<size_type>(std::declval<const H&>().get().size())) {
+		return static_cast<size_type>(mBase.get().size());
+	}
+
+	bool empty() const {
+		return begin() == end();
+	}
+
+protected:
+	holder_type mBase;
+	detail::FunctionBox<F> mFunc;
+};
+
+/**
+Filter View Class Template
+
+DESCRIPTION:
+A view of the elements of a range for which the predicate returns true. The
+number of elements is not known without walking the view, so it has no "size"
+and its iterators are forward iterators. Created with "mayaiteration::filter".
+*/
+template<typename R, typename P>
+class FilterView : public detail::ViewBase {
+	typedef typename detail::range_holder<R>::type holder_type;
+	typedef typename detail::range_iterator<typename holder_type::range_type>::type base_iterator;
+
+public:
+	class iterator {
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef iterator_category iterator_concept;
+		typedef typename std::iterator_traits<base_iterator>::reference reference;
+		typedef typename std::iterator_traits<base_iterator>::value_type value_type;
+		typedef int difference_type;
+		typedef typename std::iterator_traits<base_iterator>::pointer pointer;
+
+		iterator() : mPred(nullptr) {}
+		iterator(base_iterator it, base_iterator last, const P* pred) : mIt(it), mLast(last), mPred(pred) {
+			skip();
+		}
+
+		reference operator*() const {
+			return *mIt;
+		}
+
+		iterator& operator++() {
+			++mIt;
+			skip();
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++*this;
+			return previous;
+		}
+
+		bool operator==(const iterator& other) const { return mIt == other.mIt; }
+		bool operator!=(const iterator& other) const { return !(mIt == other.mIt); }
+
+	protected:
+		base_iterator mIt;
+		base_iterator mLast;
+		const P* mPred;
+
+		// moves to the next element that passes the predicate
+		void skip() {
+			while (mIt != mLast && !(*mPred)(*mIt))
+				++mIt;
+		}
+	};
+
+	typedef iterator const_iterator;
+
+	FilterView(holder_type base, const P& pred) : mBase(std::move(base)), mPred(pred) {}
+
+	iterator begin() const {
+		return iterator(mBase.get().begin(), mBase.get().end(), &mPred.get());
+	}
+
+	iterator end() const {
+		return iterator(mBase.get().end(), mBase.get().end(), &mPred.get());
+	}
+
+	bool empty() const {
+		return begin() == end();
+	}
+
+protected:
+	holder_type mBase;
+	detail::FunctionBox<P> mPred;
+};
+
+/**
+Zip View Class Template
+
+DESCRIPTION:
+A view of two ranges side by side, where each element is a std::pair of
+references to the elements at the same position of both ranges. The view has
+as many elements as the shorter range. Created with "mayaiteration::zip".
+*/
+template<typename R1, typename R2>
+class ZipView : public detail::ViewBase {
+	typedef typename detail::range_holder<R1>::type holder_type1;
+	typedef typename detail::range_holder<R2>::type holder_type2;
+	typedef typename detail::range_iterator<typename holder_type1::range_type>::type base_iterator1;
+	typedef typename detail::range_iterator<typename holder_type2::range_type>::type base_iterator2;
+
+public:
+	typedef unsigned int size_type;
+
+	class iterator {
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef iterator_category iterator_concept;
+		typedef std::pair<typename std::iterator_traits<base_iterator1>::reference,
+			typename std::iterator_traits<base_iterator2>::reference> reference;
+		typedef std::pair<typename std::iterator_traits<base_iterator1>::value_type,
+			typename std::iterator_traits<base_iterator2>::value_type> value_type;
+		typedef int difference_type;
+		typedef void pointer;
+
+		iterator() {}
+		iterator(base_iterator1 it1, base_iterator2 it2) : mIt1(it1), mIt2(it2) {}
+
+		reference operator*() const {
+			return reference(*mIt1, *mIt2);
+		}
+
+		reference operator[](difference_type n) const {
+			return reference(*(mIt1 + n), *(mIt2 + n));
+		}
+
+		iterator& operator++() {
+			++mIt1;
+			++mIt2;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++*this;
+			return previous;
+		}
+
+		iterator& operator--() {
+			--mIt1;
+			--mIt2;
+			return *this;
+		}
+
+		iterator operator--(int) {
+			iterator previous(*this);
+			--*this;
+			return previous;
+		}
+
+		iterator& operator+=(difference_type n) {
+			mIt1 += n;
+			mIt2 += n;
+			return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+			mIt1 -= n;
+			mIt2 -= n;
+			return *this;
+		}
+
+		iterator operator+(difference_type n) const {
+			return iterator(mIt1 + n, mIt2 + n);
+		}
+
+		friend iterator operator+(difference_type n, const iterator& it) {
+			return it + n;
+		}
+
+		iterator operator-(difference_type n) const {
+			return iterator(mIt1 - n, mIt2 - n);
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return static_cast<difference_type>(mIt1 - other.mIt1);
+		}
+
+		// the first range decides the position, the end of the view is made for it
+		bool operator==(const iterator& other) const { return mIt1 == other.mIt1; }
+		bool operator!=(const iterator& other) const { return !(mIt1 == other.mIt1); }
+		bool operator<(const iterator& other) const { return mIt1 < other.mIt1; }
+		bool operator>(const iterator& other) const { return other.mIt1 < mIt1; }
+		bool operator<=(const iterator& other) const { return !(other.mIt1 < mIt1); }
+		bool operator>=(const iterator& other) const { return !(mIt1 < other.mIt1); }
+
+	protected:
+		base_iterator1 mIt1;
+		base_iterator2 mIt2;
+	};
+
+	typedef iterator const_iterator;
+
+	ZipView(holder_type1 base1, holder_type2 base2) : mBase1(std::move(base1)), mBase2(std::move(base2)) {}
+
+	iterator begin() const {
+		return iterator(mBase1.get().begin(), mBase2.get().begin());
+	}
+
+	iterator end() const {
+		const difference_type count = static_cast<difference_type>(size());
+		return iterator(mBase1.get().begin() + count, mBase2.get().begin() + count);
+	}
+
+	size_type size() const {
+		size_type size1 = static_cast<size_type>(mBase1.get().size());
+		size_type size2 = static_cast<size_type>(mBase2.get().size());
+		return size1 < size2 ? size1 : size2;
+	}
+
+	bool empty() const {
+		return size() == 0;
+	}
+
+protected:
+	typedef int difference_type;
+
+	holder_type1 mBase1;
+	holder_type2 mBase2;
+};
+
+/**
+Enumerate View Class Template
+
+DESCRIPTION:
+A view of a range where each element is a MayaIndexedElement with the index of
+the element and a reference to it. Created with "mayaiteration::enumerate".
+*/
+template<typename R>
+class EnumerateView : public detail::ViewBase {
+	typedef typename detail::range_holder<R>::type holder_type;
+	typedef typename detail::range_iterator<typename holder_type::range_type>::type base_iterator;
+
+public:
+	typedef unsigned int size_type;
+
+	class iterator {
+	public:
+		typedef typename std::iterator_traits<base_iterator>::iterator_category iterator_category;
+		typedef iterator_category iterator_concept;
+		typedef MayaIndexedElement<typename std::iterator_traits<base_iterator>::reference> reference;
+		typedef reference value_type;
+		typedef int difference_type;
+		typedef void pointer;
+
+		iterator() : mIndex(0) {}
+		iterator(base_iterator it, unsigned int index) : mIt(it), mIndex(index) {}
+
+		reference operator*() const {
+			reference element = { mIndex, *mIt };
+			return element;
+		}
+
+		reference operator[](difference_type n) const {
+			reference element = { mIndex + n, *(mIt + n) };
+			return element;
+		}
+
+		iterator& operator++() {
+			++mIt;
+			++mIndex;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++*this;
+			return previous;
+		}
+
+		iterator& operator--() {
+			--mIt;
+			--mIndex;
+			return *this;
+		}
+
+		iterator operator--(int) {
+			iterator previous(*this);
+			--*this;
+			return previous;
+		}
+
+		iterator& operator+=(difference_type n) {
+			mIt += n;
+			mIndex += n;
+			return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+			mIt -= n;
+			mIndex -= n;
+			return *this;
+		}
+
+		iterator operator+(difference_type n) const {
+			return iterator(mIt + n, mIndex + n);
+		}
+
+		friend iterator operator+(difference_type n, const iterator& it) {
+			return it + n;
+		}
+
+		iterator operator-(difference_type n) const {
+			return iterator(mIt - n, mIndex - n);
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return static_cast<difference_type>(mIt - other.mIt);
+		}
+
+		bool operator==(const iterator& other) const { return mIt == other.mIt; }
+		bool operator!=(const iterator& other) const { return !(mIt == other.mIt); }
+		bool operator<(const iterator& other) const { return mIt < other.mIt; }
+		bool operator>(const iterator& other) const { return other.mIt < mIt; }
+		bool operator<=(const iterator& other) const { return !(other.mIt < mIt); }
+		bool operator>=(const iterator& other) const { return !(mIt < other.mIt); }
+
+	protected:
+		base_iterator mIt;
+		unsigned int mIndex;
+	};
+
+	typedef iterator const_iterator;
+
+	explicit EnumerateView(holder_type base) : mBase(std::move(base)) {}
+
+	iterator begin() const {
+		return iterator(mBase.get().begin(), 0);
+	}
+
+	iterator end() const {
+		return iterator(mBase.get().end(), endIndex(typename std::iterator_traits<base_iterator>::iterator_category()));
+	}
+
+	// only available when the range has a size
+	template<typename H=holder_type>
+	auto size() const -> decltype(static_cast<size_type>(std::declval<const H&>().get().size())) {
+		return static_cast<size_type>(mBase.get().size());
+	}
+
+	bool empty() const {
+		return begin() == end();
+	}
+
+protected:
+	holder_type mBase;
+
+	unsigned int endIndex(std::random_access_iterator_tag) const {
+		return static_cast<unsigned int>(mBase.get().end() - mBase.get().begin());
+	}
+
+	// the end of a forward or input range can not be stepped back from, so its
+	// index is never read
+	unsigned int endIndex(std::input_iterator_tag) const {
+		return 0;
+	}
+};
+
+/**
+Stride View Class Template
+
+DESCRIPTION:
+A view of every "step" element of a random access range, starting with the
+first, such as the x components of a flat array of xyz floats. Created with
+"mayaiteration::stride".
+*/
+template<typename R>
+class StrideView : public detail::ViewBase {
+	typedef typename detail::range_holder<R>::type holder_type;
+	typedef typename detail::range_iterator<typename holder_type::range_type>::type base_iterator;
+
+public:
+	typedef unsigned int size_type;
+
+	class iterator {
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef iterator_category iterator_concept;
+		typedef typename std::iterator_traits<base_iterator>::reference reference;
+		typedef typename std::iterator_traits<base_iterator>::value_type value_type;
+		typedef int difference_type;
+		typedef typename std::iterator_traits<base_iterator>::pointer pointer;
+
+		iterator() : mIndex(0), mStep(1) {}
+		iterator(base_iterator first, unsigned int index, unsigned int step) : mFirst(first), mIndex(index), mStep(step) {}
+
+		// the position is kept as an index so the iterator never moves past the end of the range
+		reference operator*() const {
+			return *(mFirst + static_cast<difference_type>(mIndex * mStep));
+		}
+
+		reference operator[](difference_type n) const {
+			return *(mFirst + static_cast<difference_type>((mIndex + n) * mStep));
+		}
+
+		iterator& operator++() {
+			++mIndex;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator previous(*this);
+			++mIndex;
+			return previous;
+		}
+
+		iterator& operator--() {
+			--mIndex;
+			return *this;
+		}
+
+		iterator operator--(int) {
+			iterator previous(*this);
+			--mIndex;
+			return previous;
+		}
+
+		iterator& operator+=(difference_type n) {
+			mIndex += n;
+			return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+			mIndex -= n;
+			return *this;
+		}
+
+		iterator operator+(difference_type n) const {
+			return iterator(mFirst, mIndex + n, mStep);
+		}
+
+		friend iterator operator+(difference_type n, const iterator& it) {
+			return it + n;
+		}
+
+		iterator operator-(difference_type n) const {
+			return iterator(mFirst, mIndex - n, mStep);
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return static_cast<difference_type>(mIndex) - static_cast<difference_type>(other.mIndex);
+		}
+
+		bool operator==(const iterator& other) const { return mIndex == other.mIndex; }
+		bool operator!=(const iterator& other) const { return mIndex != other.mIndex; }
+		bool operator<(const iterator& other) const { return mIndex < other.mIndex; }
+		bool operator>(const iterator& other) const { return other.mIndex < mIndex; }
+		bool operator<=(const iterator& other) const { return !(other.mIndex < mIndex); }
+		bool operator>=(const iterator& other) const { return !(mIndex < other.mIndex); }
+
+	protected:
+		base_iterator mFirst;
+		unsigned int mIndex;
+		unsigned int mStep;
+	};
+
+	typedef iterator const_iterator;
+
+	StrideView(holder_type base, unsigned int step) : mBase(std::move(base)), mStep(step ? step : 1) {}
+
+	iterator begin() const {
+		return iterator(mBase.get().begin(), 0, mStep);
+	}
+
+	iterator end() const {
+		return iterator(mBase.get().begin(), size(), mStep);
+	}
+
+	size_type size() const {
+		size_type count = static_cast<size_type>(mBase.get().end() - mBase.get().begin());
+		return (count + mStep - 1) / mStep;
+	}
+
+	bool empty() const {
+		return size() == 0;
+	}
+
+protected:
+	holder_type mBase;
+	unsigned int mStep;
+};
+
+/**
+Creates a lazy view that calls the function on each element of the range, such
+as a MayaArray, MayaArrayRange, MayaSpan or another view. A range passed as an
+lvalue must outlive the view, a range passed as an rvalue is kept by the view.
+
+USAGE:
+	auto lengths = mayaiteration::transform(vectors, [](const MVector& v) { return v.length(); });
+
+\param[in] range the range to view
+\param[in] func function called with each element
+
+\return
+the view
+*/
+template<typename R, typename F>
+inline TransformView<R, F> transform(R&& range, F func) {
+	return TransformView<R, F>(typename detail::range_holder<R>::type(std::forward<R>(range)), func);
+}
+
+/**
+Creates a lazy view of the elements of the range for which the predicate
+returns true
+
+\param[in] range the range to view
+\param[in] pred predicate called with each element
+
+\return
+the view
+*/
+template<typename R, typename P>
+inline FilterView<R, P> filter(R&& range, P pred) {
+	return FilterView<R, P>(typename detail::range_holder<R>::type(std::forward<R>(range)), pred);
+}
+
+/**
+Creates a lazy view of two ranges side by side, each element is a std::pair of
+references to the elements of both ranges
+
+\param[in] range1 the first range, it must be random access
+\param[in] range2 the second range, it must be random access
+
+\return
+the view
+*/
+template<typename R1, typename R2>
+inline ZipView<R1, R2> zip(R1&& range1, R2&& range2) {
+	return ZipView<R1, R2>(typename detail::range_holder<R1>::type(std::forward<R1>(range1)),
+		typename detail::range_holder<R2>::type(std::forward<R2>(range2)));
+}
+
+/**
+Creates a lazy view with the index of each element of the range
+
+\param[in] range the range to view
+
+\return
+the view
+*/
+template<typename R>
+inline EnumerateView<R> enumerate(R&& range) {
+	return EnumerateView<R>(typename detail::range_holder<R>::type(std::forward<R>(range)));
+}
+
+/**
+Creates a lazy view of every "step" element of the range, starting with the first
+
+\param[in] range the range to view, it must be random access
+\param[in] step distance between the viewed elements
+
+\return
+the view
+*/
+template<typename R>
+inline StrideView<R> stride(R&& range, unsigned int step) {
+	return StrideView<R>(typename detail::range_holder<R>::type(std::forward<R>(range)), step);
+}
+
+namespace detail {
+
+// views with a size are written in place after growing the destination once
+template<typename View, typename Array>
+void materializeInto(const View& view, Array& destination, std::true_type) {
+	const unsigned int count = static_cast<unsigned int>(view.size());
+	if (destination.size() < count)
+		destination.resize(count);
+	unsigned int i = 0;
+	for (typename View::iterator it = view.begin(), last = view.end(); it != last; ++it, ++i)
+		destination[i] = *it;
+	if (count < destination.size())
+		destination.resize(count);
+}
+
+// views without a size, such as filters, overwrite the existing elements and
+// only append once they run out
+template<typename View, typename Array>
+void materializeInto(const View& view, Array& destination, std::false_type) {
+	unsigned int i = 0;
+	for (typename View::iterator it = view.begin(), last = view.end(); it != last; ++it, ++i) {
+		if (i < destination.size())
+			destination[i] = *it;
+		else
+			destination.push_back(*it);
+	}
+	destination.resize(i);
+}
+
+// lets raw Maya arrays be filled the same way as MayaArrays
+template<typename T>
+class RawArrayWriter {
+public:
+	explicit RawArrayWriter(T& maya_array) : mArray(maya_array) {}
+
+	unsigned int size() const { return mArray.length(); }
+	void resize(unsigned int count) { mArray.setLength(count); }
+	decltype(std::declval<T&>()[0]) operator[](unsigned int i) { return mArray[i]; }
+	template<typename V>
+	void push_back(const V& value) { mArray.append(value); }
+
+protected:
+	T& mArray;
+};
+
+} // namespace detail
+
+/**
+Writes all elements of a view into the destination array, resizing it to the
+number of elements of the view. This is the only place the elements are stored,
+so a chain of views only makes one array. The destination can be the array that
+the view reads from, since no view reads an element before the element it
+writes.
+
+USAGE:
+	mayaiteration::materialize(mayaiteration::transform(mayaiteration::zip(restPoints, deltas),
+		[&](const std::pair<const MPoint&, const MVector&>& p) { return p.first + p.second * envelope; }),
+		outPoints);
+
+\param[in] view the view to write
+\param[out] destination the MayaArray to write to
+*/
+template<typename View, typename T, typename P>
+void materialize(const View& view, mayaarray::MayaArray<T, P>& destination) {
+	detail::materializeInto(view, destination, typename detail::has_size<const View>::type());
+}
+
+/**
+Writes all elements of a view into the destination Maya array, resizing it to
+the number of elements of the view
+
+\param[in] view the view to write
+\param[out] destination the Maya array to write to
+*/
+template<typename View, typename T>
+void materialize(const View& view, T& destination) {
+	detail::RawArrayWriter<T> writer(destination);
+	detail::materializeInto(view, writer, typename detail::has_size<const View>::type());
+}
+
+} // namespace mayaiteration
+
+#endif // MAYAITERATION_MAYA_VIEWS_H_
@@ -0,0 +1,98 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2026 Scott Englert
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef MAYATEMPLATES_MAYA_ARRAY_TRAITS_H_
+#define MAYATEMPLATES_MAYA_ARRAY_TRAITS_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <maya/MApiNamespace.h>
+
+namespace mayatemplates {
+
+/*
+Trait that reports if a Maya array type keeps all of its elements in one
+contiguous block of memory, so that the address of the first element can be
+used as a raw pointer to the whole array. This holds for Maya's numeric and
+geometric arrays, but not for arrays of handles such as MPlugArray or
+MDagPathArray which are left with the default of false.
+*/
+template<typename T>
+struct is_contiguous_array : std::false_type {};
+
+template<> struct is_contiguous_array<MIntArray> : std::true_type {};
+template<> struct is_contiguous_array<MUintArray> : std::true_type {};
+template<> struct is_contiguous_array<MInt64Array> : std::true_type {};
+template<> struct is_contiguous_array<MFloatArray> : std::true_type {};
+template<> struct is_contiguous_array<MDoubleArray> : std::true_type {};
+template<> struct is_contiguous_array<MPointArray> : std::true_type {};
+template<> struct is_contiguous_array<MFloatPointArray> : std::true_type {};
+template<> struct is_contiguous_array<MVectorArray> : std::true_type {};
+template<> struct is_contiguous_array<MFloatVectorArray> : std::true_type {};
+template<> struct is_contiguous_array<MColorArray> : std::true_type {};
+template<> struct is_contiguous_array<MMatrixArray> : std::true_type {};
+
+namespace detail {
+
+template<typename T, typename V>
+struct has_raw_get {
+	template<typename U>
+	static auto test(int) -> decltype(std::declval<const U&>().get(std::declval<V*>()), std::true_type());
+	template<typename U>
+	static std::false_type test(...);
+	typedef decltype(test<T>(0)) type;
+};
+
+} // namespace detail
+
+/*
+Compile time description of a Maya array type, used to pick the fastest way to
+copy, fill and move its elements.
+
+is_contiguous: all elements are in one block of memory, see is_contiguous_array
+is_bitwise_copyable: elements can be copied with memcpy. Maya's value types
+such as MPoint and MMatrix declare their own copy constructors, so they are not
+trivially copyable in the standard sense, but they only hold numbers and the
+elements of contiguous arrays are treated as plain data.
+is_raw_copyable: both of the above, so whole ranges can be copied with memcpy
+has_raw_get: has "get(value_type[])" that copies all elements out
+has_raw_constructor: can be constructed from "(const value_type[], unsigned int)"
+element_width: size of an element in bytes
+*/
+template<typename T>
+struct maya_array_traits {
+	typedef typename std::remove_reference<decltype(std::declval<T&>()[0])>::type value_type;
+
+	typedef is_contiguous_array<T> is_contiguous;
+	typedef std::integral_constant<bool, is_contiguous::value || std::is_trivially_copyable<value_type>::value> is_bitwise_copyable;
+	typedef std::integral_constant<bool, is_contiguous::value && is_bitwise_copyable::value> is_raw_copyable;
+	typedef typename detail::has_raw_get<T, value_type>::type has_raw_get;
+	typedef std::integral_constant<bool, std::is_constructible<T, const value_type*, unsigned int>::value> has_raw_constructor;
+
+	static const std::size_t element_width = sizeof(value_type);
+};
+
+} // namespace mayatemplates
+
+#endif // MAYATEMPLATES_MAYA_ARRAY_TRAITS_H_
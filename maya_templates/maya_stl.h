@@ -24,13 +24,245 @@ THE SOFTWARE.
 #ifndef MAYATEMPLATES_MAYA_STL_H_
 #define MAYATEMPLATES_MAYA_STL_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <maya/MDagPath.h>
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
 #include <maya/MString.h>
 #include <maya/MUniqueString.h>
+#include <maya/MUuid.h>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace mayatemplates {
+
+namespace detail {
+
+// 64 bit multiply returning the low half in "a" and the high half in "b"
+inline void hashMultiply(uint64_t* a, uint64_t* b) {
+#if defined(__SIZEOF_INT128__)
+	__uint128_t r = *a;
+	r *= *b;
+	*a = static_cast<uint64_t>(r);
+	*b = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	*a = _umul128(*a, *b, b);
+#else
+	uint64_t ha = *a >> 32, hb = *b >> 32, la = static_cast<uint32_t>(*a), lb = static_cast<uint32_t>(*b);
+	uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	uint64_t t = rl + (rm0 << 32), c = t < rl;
+	uint64_t lo = t + (rm1 << 32);
+	c += lo < t;
+	*a = lo;
+	*b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64_t hashMix(uint64_t a, uint64_t b) {
+	hashMultiply(&a, &b);
+	return a ^ b;
+}
+
+inline uint64_t hashRead8(const unsigned char* p) {
+	uint64_t v;
+	std::memcpy(&v, p, 8);
+	return v;
+}
+
+inline uint64_t hashRead4(const unsigned char* p) {
+	uint32_t v;
+	std::memcpy(&v, p, 4);
+	return v;
+}
+
+inline uint64_t hashRead3(const unsigned char* p, std::size_t k) {
+	return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+
+} // namespace detail
+
+/*
+Hashes a block of bytes. This is a wyhash style hash that reads 8 bytes at a
+time, which makes it fast for the short names found in scenes while still
+mixing well for long paths. The results are the same on every platform with
+the same byte order.
+*/
+inline std::size_t hashBytes(const void* data, std::size_t length, uint64_t seed=0) {
+	static const uint64_t s0 = 0xa0761d6478bd642full, s1 = 0xe7037ed1a0b428dbull;
+	static const uint64_t s2 = 0x8ebc6af09c88c6e3ull, s3 = 0x589965cc75374cc3ull;
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	uint64_t a, b;
+	seed ^= detail::hashMix(seed ^ s0, s1);
+	if (length <= 16) {
+		if (4 <= length) {
+			a = (detail::hashRead4(p) << 32) | detail::hashRead4(p + ((length >> 3) << 2));
+			b = (detail::hashRead4(p + length - 4) << 32) | detail::hashRead4(p + length - 4 - ((length >> 3) << 2));
+		}
+		else if (0 < length) {
+			a = detail::hashRead3(p, length);
+			b = 0;
+		}
+		else {
+			a = b = 0;
+		}
+	}
+	else {
+		std::size_t i = length;
+		if (48 < i) {
+			uint64_t see1 = seed, see2 = seed;
+			do {
+				seed = detail::hashMix(detail::hashRead8(p) ^ s1, detail::hashRead8(p + 8) ^ seed);
+				see1 = detail::hashMix(detail::hashRead8(p + 16) ^ s2, detail::hashRead8(p + 24) ^ see1);
+				see2 = detail::hashMix(detail::hashRead8(p + 32) ^ s3, detail::hashRead8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (48 < i);
+			seed ^= see1 ^ see2;
+		}
+		while (16 < i) {
+			seed = detail::hashMix(detail::hashRead8(p) ^ s1, detail::hashRead8(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = detail::hashRead8(p + i - 16);
+		b = detail::hashRead8(p + i - 8);
+	}
+	a ^= s1;
+	b ^= seed;
+	detail::hashMultiply(&a, &b);
+	return static_cast<std::size_t>(detail::hashMix(a ^ s0 ^ length, b ^ s1));
+}
+
+/*
+Hashes the contents of a string
+*/
+inline std::size_t hashString(const MString& value) {
+	return hashBytes(value.asChar(), value.length());
+}
+
+inline std::size_t hashString(const char* value) {
+	return hashBytes(value, std::strlen(value));
+}
+
+inline std::size_t hashString(const MUniqueString& value) {
+	return hashString(value.asChar());
+}
+
+/*
+A MString key that stores its hash, so hash containers do not hash the string
+again when they look it up or rehash. The string should not be changed after
+it is created, which is why only const access to it is given.
+*/
+class HashedMString {
+public:
+	HashedMString() : mHash(hashString(mString)) {}
+	HashedMString(const MString& value) : mString(value), mHash(hashString(value)) {}
+	HashedMString(const char* value) : mString(value), mHash(hashString(value)) {}
+
+	const MString& str() const {
+		return mString;
+	}
+
+	operator const MString&() const {
+		return mString;
+	}
+
+	std::size_t hash() const {
+		return mHash;
+	}
+
+	bool operator==(const HashedMString& other) const {
+		return mHash == other.mHash && mString == other.mString;
+	}
+
+	bool operator!=(const HashedMString& other) const {
+		return !(*this == other);
+	}
+
+protected:
+	MString mString;
+	std::size_t mHash;
+};
+
+/*
+Transparent hash for MString keys that also hashes HashedMString, MUniqueString
+and const char* the same way. Together with MStringEqual it allows hash
+containers with heterogeneous lookup (C++20) to be probed without building a
+temporary MString.
+*/
+struct MStringHash {
+	typedef void is_transparent;
+
+	std::size_t operator()(const MString& value) const {
+		return hashString(value);
+	}
+
+	std::size_t operator()(const HashedMString& value) const {
+		return value.hash();
+	}
+
+	std::size_t operator()(const MUniqueString& value) const {
+		return hashString(value);
+	}
+
+	std::size_t operator()(const char* value) const {
+		return hashString(value);
+	}
+};
+
+/*
+Transparent equality for MString keys that compares the contents of MString,
+HashedMString, MUniqueString and const char* values with each other.
+*/
+struct MStringEqual {
+	typedef void is_transparent;
+
+	template<typename A, typename B>
+	bool operator()(const A& valueA, const B& valueB) const {
+		return std::strcmp(chars(valueA), chars(valueB)) == 0;
+	}
+
+	bool operator()(const MString& valueA, const MString& valueB) const {
+		return valueA == valueB;
+	}
+
+	bool operator()(const HashedMString& valueA, const HashedMString& valueB) const {
+		return valueA == valueB;
+	}
+
+protected:
+	static const char* chars(const MString& value) { return value.asChar(); }
+	static const char* chars(const HashedMString& value) { return value.str().asChar(); }
+	static const char* chars(const MUniqueString& value) { return value.asChar(); }
+	static const char* chars(const char* value) { return value; }
+};
+
+/*
+Mixes a value into a hash, for hashing types made of several values
+*/
+inline std::size_t hashCombine(std::size_t seed, std::size_t value) {
+	return static_cast<std::size_t>(detail::hashMix(seed ^ 0xa0761d6478bd642full, value ^ 0xe7037ed1a0b428dbull));
+}
+
+/*
+Hashes the node a MObject points to, the same way MObjectHandle::hashCode does
+*/
+inline std::size_t hashObject(const MObject& object) {
+	return MObjectHandle(object).hashCode();
+}
+
+} // namespace mayatemplates
 
 namespace std {
 	/*
-	Standard Template Library hash specialization for MStrings
+	Standard Template Library hash specialization for MStrings. This hashes the
+	characters of the string directly, so strings are not interned just to be
+	hashed. The values are not the same as MUniqueString::hash.
 	*/
 	template<>
 	class hash<MString>
@@ -38,8 +270,7 @@ namespace std {
 	public:
 		size_t operator() (const MString& value) const
 		{
-			MUniqueString uniqueString = MUniqueString::intern(value);
-			return uniqueString.hash();
+			return mayatemplates::hashString(value);
 		}
 	};
 
@@ -55,6 +286,149 @@ namespace std {
 			return valueA == valueB;
 		}
 	};
+
+	/*
+	Standard Template Library hash specialization for HashedMStrings, which
+	returns the stored hash
+	*/
+	template<>
+	class hash<mayatemplates::HashedMString>
+	{
+	public:
+		size_t operator() (const mayatemplates::HashedMString& value) const
+		{
+			return value.hash();
+		}
+	};
+
+	/*
+	Standard Template Library hash specialization for MObjectHandles, which
+	uses the hash code Maya provides for the node
+	*/
+	template<>
+	class hash<MObjectHandle>
+	{
+	public:
+		size_t operator() (const MObjectHandle& value) const
+		{
+			return value.hashCode();
+		}
+	};
+
+	/*
+	Standard Template Library equal_to specialization for MObjectHandles
+	*/
+	template <>
+	class equal_to<MObjectHandle>
+	{
+	public:
+		bool operator() (const MObjectHandle& valueA, const MObjectHandle& valueB) const
+		{
+			return valueA == valueB;
+		}
+	};
+
+	/*
+	Standard Template Library hash specialization for MUuids, which hashes
+	the 16 bytes of the id
+	*/
+	template<>
+	class hash<MUuid>
+	{
+	public:
+		size_t operator() (const MUuid& value) const
+		{
+			unsigned char bytes[16];
+			value.get(bytes);
+			return mayatemplates::hashBytes(bytes, sizeof(bytes));
+		}
+	};
+
+	/*
+	Standard Template Library equal_to specialization for MUuids
+	*/
+	template <>
+	class equal_to<MUuid>
+	{
+	public:
+		bool operator() (const MUuid& valueA, const MUuid& valueB) const
+		{
+			return valueA == valueB;
+		}
+	};
+
+	/*
+	Standard Template Library hash specialization for MDagPaths. Each instance
+	of a node has its own path, so the path is identified by the node and the
+	instance number instead of building the full path name.
+	*/
+	template<>
+	class hash<MDagPath>
+	{
+	public:
+		size_t operator() (const MDagPath& value) const
+		{
+			return mayatemplates::hashCombine(mayatemplates::hashObject(value.node()), value.instanceNumber());
+		}
+	};
+
+	/*
+	Standard Template Library equal_to specialization for MDagPaths, paths are
+	equal when they are the same instance of the same node
+	*/
+	template <>
+	class equal_to<MDagPath>
+	{
+	public:
+		bool operator() (const MDagPath& valueA, const MDagPath& valueB) const
+		{
+			return valueA == valueB;
+		}
+	};
+
+	/*
+	Standard Template Library hash specialization for MPlugs. It combines the
+	node, the attribute and the logical index of the plug and of every array
+	element above it, so elements of nested arrays such as
+	weightList[i].weights[j] get a different hash for every i.
+	*/
+	template<>
+	class hash<MPlug>
+	{
+	public:
+		size_t operator() (const MPlug& value) const
+		{
+			size_t seed = mayatemplates::hashCombine(mayatemplates::hashObject(value.node()), mayatemplates::hashObject(value.attribute()));
+			MPlug plug(value);
+			for (;;) {
+				if (plug.isElement()) {
+					seed = mayatemplates::hashCombine(seed, plug.logicalIndex());
+					plug = plug.array();
+				}
+				else if (plug.isChild()) {
+					plug = plug.parent();
+				}
+				else {
+					break;
+				}
+			}
+			return seed;
+		}
+	};
+
+	/*
+	Standard Template Library equal_to specialization for MPlugs, plugs are
+	equal when they refer to the same attribute and element of the same node
+	*/
+	template <>
+	class equal_to<MPlug>
+	{
+	public:
+		bool operator() (const MPlug& valueA, const MPlug& valueB) const
+		{
+			return valueA == valueB;
+		}
+	};
 } // std namespace
 
 #endif // MAYATEMPLATES_MAYA_STL_H_
\ No newline at end of file